@@ -0,0 +1,149 @@
+#include <cpprealm/experimental/blob_stream.hpp>
+#include <cpprealm/internal/bridge/binary.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace realm::experimental {
+    blob_reader::blob_reader(internal::bridge::obj obj, internal::bridge::col_key key, size_t offset)
+        : m_obj(std::move(obj)), m_key(std::move(key)) {
+        seek(offset);
+    }
+
+    blob_reader::blob_reader(internal::bridge::list chunks, size_t offset)
+        : m_chunks(std::move(chunks)) {
+        seek(offset);
+    }
+
+    size_t blob_reader::read(uint8_t* dest, size_t count) {
+        if (!m_chunks) {
+            auto copied = m_obj.read_binary(m_key, m_offset, dest, count);
+            m_offset += copied;
+            return copied;
+        }
+
+        size_t total = 0;
+        const size_t chunk_count = m_chunks->size();
+        while (total < count && m_chunk < chunk_count) {
+            auto copied = m_chunks->read_binary(m_chunk, m_chunk_offset, dest + total, count - total);
+            total += copied;
+            m_chunk_offset += copied;
+            if (m_chunk_offset >= m_chunks->get_binary_size(m_chunk)) {
+                ++m_chunk;
+                m_chunk_offset = 0;
+            }
+        }
+        m_offset += total;
+        return total;
+    }
+
+    std::vector<uint8_t> blob_reader::read(size_t max) {
+        std::vector<uint8_t> ret(max);
+        ret.resize(read(ret.data(), max));
+        return ret;
+    }
+
+    void blob_reader::seek(size_t offset) {
+        m_offset = offset;
+        if (!m_chunks) {
+            return;
+        }
+        m_chunk = 0;
+        m_chunk_offset = offset;
+        const size_t chunk_count = m_chunks->size();
+        while (m_chunk < chunk_count) {
+            auto chunk_size = m_chunks->get_binary_size(m_chunk);
+            if (m_chunk_offset < chunk_size) {
+                break;
+            }
+            m_chunk_offset -= chunk_size;
+            ++m_chunk;
+        }
+    }
+
+    size_t blob_reader::size() const {
+        if (!m_chunks) {
+            return m_obj.get_binary_size(m_key);
+        }
+        size_t total = 0;
+        for (size_t i = 0; i < m_chunks->size(); i++) {
+            total += m_chunks->get_binary_size(i);
+        }
+        return total;
+    }
+
+    bool blob_reader::eof() const {
+        if (!m_chunks) {
+            return m_offset >= m_obj.get_binary_size(m_key);
+        }
+        return m_chunk >= m_chunks->size();
+    }
+
+    blob_writer::blob_writer(internal::bridge::obj obj, internal::bridge::col_key key)
+        : m_obj(std::move(obj)), m_key(std::move(key)), m_chunk_size(max_chunk_size) {}
+
+    blob_writer::blob_writer(internal::bridge::list chunks, size_t chunk_size)
+        : m_chunks(std::move(chunks)), m_chunk_size(std::clamp<size_t>(chunk_size, 1, max_chunk_size)) {
+        m_chunks->remove_all();
+        m_buffer.reserve(m_chunk_size);
+    }
+
+    blob_writer::blob_writer(blob_writer&& other)
+        : m_obj(std::move(other.m_obj))
+        , m_key(std::move(other.m_key))
+        , m_chunks(std::move(other.m_chunks))
+        , m_chunk_size(other.m_chunk_size)
+        , m_buffer(std::move(other.m_buffer))
+        , m_size(other.m_size)
+        , m_closed(other.m_closed) {
+        other.m_closed = true;
+    }
+
+    // Writing to the Realm can throw, so unclosed writers discard their buffer instead.
+    blob_writer::~blob_writer() = default;
+
+    void blob_writer::write(const uint8_t* data, size_t count) {
+        if (m_closed) {
+            throw std::logic_error("Cannot write to a closed blob_writer.");
+        }
+        if (!m_chunks) {
+            if (m_size + count > max_chunk_size) {
+                throw std::logic_error("Binary value exceeds the maximum size of a single value, write it to a list of binary chunks instead.");
+            }
+            m_buffer.insert(m_buffer.end(), data, data + count);
+            m_size += count;
+            return;
+        }
+
+        m_size += count;
+        while (count > 0) {
+            auto n = std::min(count, m_chunk_size - m_buffer.size());
+            m_buffer.insert(m_buffer.end(), data, data + n);
+            data += n;
+            count -= n;
+            if (m_buffer.size() == m_chunk_size) {
+                flush_chunk();
+            }
+        }
+    }
+
+    void blob_writer::close() {
+        if (m_closed) {
+            return;
+        }
+        m_closed = true;
+        if (m_chunks) {
+            if (!m_buffer.empty()) {
+                flush_chunk();
+            }
+        } else {
+            m_obj.set(m_key, internal::bridge::binary(m_buffer));
+        }
+        m_buffer = std::vector<uint8_t>();
+    }
+
+    void blob_writer::flush_chunk() {
+        m_chunks->add(internal::bridge::binary(m_buffer));
+        m_buffer.clear();
+    }
+}
@@ -0,0 +1,92 @@
+#ifndef CPPREALM_BLOB_STREAM_HPP
+#define CPPREALM_BLOB_STREAM_HPP
+
+#include <cpprealm/internal/bridge/col_key.hpp>
+#include <cpprealm/internal/bridge/list.hpp>
+#include <cpprealm/internal/bridge/obj.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace realm::experimental {
+
+    /**
+     Sequentially reads a binary property without copying the whole value.
+
+     The source is either a single binary property, or a list of binary values which
+     together hold one payload split into chunks. Each call to `read` copies only the
+     requested bytes out of the Realm, so memory use is independent of the blob's size.
+     */
+    class blob_reader {
+    public:
+        blob_reader(internal::bridge::obj obj, internal::bridge::col_key key, size_t offset = 0);
+        blob_reader(internal::bridge::list chunks, size_t offset = 0);
+
+        /// Copies up to `count` bytes into `dest` and returns the number copied,
+        /// which is zero once the end of the blob has been reached.
+        size_t read(uint8_t* dest, size_t count);
+        /// Reads up to `max` bytes into a new vector.
+        std::vector<uint8_t> read(size_t max);
+
+        void seek(size_t offset);
+        [[nodiscard]] size_t tell() const noexcept { return m_offset; }
+        [[nodiscard]] size_t size() const;
+        [[nodiscard]] bool eof() const;
+
+    private:
+        internal::bridge::obj m_obj;
+        internal::bridge::col_key m_key;
+        std::optional<internal::bridge::list> m_chunks;
+        size_t m_offset = 0;
+        // Position of `m_offset` within the chunk list.
+        size_t m_chunk = 0;
+        size_t m_chunk_offset = 0;
+    };
+
+    /**
+     Writes a binary property incrementally, replacing its value.
+
+     Writing to a list of binary values splits the payload into chunks of `chunk_size`
+     bytes, each stored as its own element, and only ever buffers one chunk; this is how
+     to store payloads larger than the 16MB a single binary value can hold. Writing to a
+     single binary property buffers the value and stores it once on `close()`.
+
+     A writer must be closed with `close()` in the write transaction it was opened in.
+     The destructor never writes to the Realm: destroying a writer which has not been
+     closed discards the bytes it has not stored yet.
+     */
+    class blob_writer {
+    public:
+        static constexpr size_t max_chunk_size = 0xFFFFF8 - 8;
+        static constexpr size_t default_chunk_size = 1024 * 1024;
+
+        blob_writer(internal::bridge::obj obj, internal::bridge::col_key key);
+        blob_writer(internal::bridge::list chunks, size_t chunk_size = default_chunk_size);
+        blob_writer(const blob_writer&) = delete;
+        blob_writer& operator=(const blob_writer&) = delete;
+        blob_writer(blob_writer&& other);
+        blob_writer& operator=(blob_writer&&) = delete;
+        ~blob_writer();
+
+        void write(const uint8_t* data, size_t count);
+        void write(const std::vector<uint8_t>& data) { write(data.data(), data.size()); }
+        /// Flushes any buffered bytes. Further writes are not allowed.
+        void close();
+        /// The number of bytes written so far.
+        [[nodiscard]] size_t size() const noexcept { return m_size; }
+
+    private:
+        void flush_chunk();
+
+        internal::bridge::obj m_obj;
+        internal::bridge::col_key m_key;
+        std::optional<internal::bridge::list> m_chunks;
+        size_t m_chunk_size = 0;
+        std::vector<uint8_t> m_buffer;
+        size_t m_size = 0;
+        bool m_closed = false;
+    };
+}
+
+#endif//CPPREALM_BLOB_STREAM_HPP
@@ -0,0 +1,174 @@
+#ifndef CPPREALM_COLLECTION_QUERY_HPP
+#define CPPREALM_COLLECTION_QUERY_HPP
+
+#include <cpprealm/experimental/macros.hpp>
+#include <cpprealm/experimental/types.hpp>
+#include <cpprealm/rbool.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace realm::experimental {
+
+    /**
+     One side of a comparison over a collection property in a type-safe query: the elements
+     of a list or set, or the values of a dictionary, quantified by `any()`, `all()` or `none()`;
+     the size of the collection from `count()`; an aggregate of its values from `sum()`,
+     `min()`, `max()` or `avg()`; the keys of a dictionary; or the value for one key of a
+     dictionary, e.g. `o.list_str_col.any() == "x"` or `o.list_int_col.sum() > 100`.
+
+     Within a query the comparison becomes the matching collection condition evaluated by core.
+     Outside of queries it is evaluated on the values of the collection.
+     */
+    template<typename T>
+    struct collection_operand {
+        using operand = internal::bridge::query::collection_operand;
+        using comparison = internal::bridge::query::comparison;
+
+        /// Refers to the collection in `property`, which is being used to build a query.
+        collection_operand(const managed_base& property, operand kind, std::string dictionary_key = {})
+            : m_query(property.query), m_key(property.m_key), m_kind(kind), m_dictionary_key(std::move(dictionary_key)) {}
+        /// Refers to the values the comparison is evaluated on outside of queries. Aggregates
+        /// which are null, such as the minimum of an empty list, have no values.
+        collection_operand(std::vector<T>&& values, operand kind)
+            : m_kind(kind), m_values(std::move(values)) {}
+
+        rbool operator==(const T& rhs) const { return compare(comparison::equal, rhs, std::equal_to<>()); }
+        rbool operator!=(const T& rhs) const { return compare(comparison::not_equal, rhs, std::not_equal_to<>()); }
+        rbool operator>(const T& rhs) const { return compare(comparison::greater, rhs, std::greater<>()); }
+        rbool operator>=(const T& rhs) const { return compare(comparison::greater_equal, rhs, std::greater_equal<>()); }
+        rbool operator<(const T& rhs) const { return compare(comparison::less, rhs, std::less<>()); }
+        rbool operator<=(const T& rhs) const { return compare(comparison::less_equal, rhs, std::less_equal<>()); }
+
+    private:
+        template<typename Compare>
+        rbool compare(comparison op, const T& rhs, Compare&& cmp) const {
+            if (m_query) {
+                auto query = internal::bridge::query(m_query->get_table());
+                if constexpr (std::is_same_v<T, std::string>) {
+                    query.collection_comparison(m_key, m_kind, op, internal::bridge::mixed(rhs), m_dictionary_key);
+                } else {
+                    query.collection_comparison(m_key, m_kind, op, internal::bridge::mixed(serialize(rhs)), m_dictionary_key);
+                }
+                return rbool(std::move(query));
+            }
+            auto matches = [&](const T& v) { return cmp(v, rhs); };
+            switch (m_kind) {
+                case operand::all:
+                    return std::all_of(m_values.begin(), m_values.end(), matches);
+                case operand::none:
+                    return std::none_of(m_values.begin(), m_values.end(), matches);
+                default:
+                    return std::any_of(m_values.begin(), m_values.end(), matches);
+            }
+        }
+
+        internal::bridge::query* m_query = nullptr;
+        internal::bridge::col_key m_key;
+        operand m_kind;
+        std::string m_dictionary_key;
+        std::vector<T> m_values;
+    };
+
+    /**
+     The query operators of collection properties, shared by lists, sets and dictionaries,
+     which compare the elements of a list or set, or the values of a dictionary.
+     */
+    template<typename Derived, typename T>
+    struct collection_query_operators {
+        using operand = internal::bridge::query::collection_operand;
+
+        /// Matches if any element satisfies the comparison.
+        collection_operand<T> any() const { return quantified(operand::any); }
+        /// Matches if every element satisfies the comparison, including when there are none.
+        collection_operand<T> all() const { return quantified(operand::all); }
+        /// Matches if no element satisfies the comparison.
+        collection_operand<T> none() const { return quantified(operand::none); }
+
+        /// The number of elements.
+        collection_operand<int64_t> count() const {
+            if (property().should_detect_usage_for_queries) {
+                return collection_operand<int64_t>(property(), operand::count);
+            }
+            return collection_operand<int64_t>({static_cast<int64_t>(values().size())}, operand::count);
+        }
+
+        /// The sum of the elements, zero if there are none.
+        auto sum() const {
+            using sum_type = std::conditional_t<std::is_integral_v<T>, int64_t, T>;
+            static_assert(std::is_arithmetic_v<T>, "sum() requires a collection of numeric values");
+            if (property().should_detect_usage_for_queries) {
+                return collection_operand<sum_type>(property(), operand::sum);
+            }
+            auto elements = values();
+            return collection_operand<sum_type>({std::accumulate(elements.begin(), elements.end(), sum_type())}, operand::sum);
+        }
+        /// The smallest element, which matches no comparison if there are none.
+        collection_operand<T> min() const {
+            static_assert(std::is_arithmetic_v<T>, "min() requires a collection of numeric values");
+            return extremum(operand::min);
+        }
+        /// The largest element, which matches no comparison if there are none.
+        collection_operand<T> max() const {
+            static_assert(std::is_arithmetic_v<T>, "max() requires a collection of numeric values");
+            return extremum(operand::max);
+        }
+        /// The average of the elements, which matches no comparison if there are none.
+        collection_operand<double> avg() const {
+            static_assert(std::is_arithmetic_v<T>, "avg() requires a collection of numeric values");
+            if (property().should_detect_usage_for_queries) {
+                return collection_operand<double>(property(), operand::avg);
+            }
+            auto elements = values();
+            if (elements.empty()) {
+                return collection_operand<double>(std::vector<double>(), operand::avg);
+            }
+            auto sum = std::accumulate(elements.begin(), elements.end(), 0.0);
+            return collection_operand<double>({sum / static_cast<double>(elements.size())}, operand::avg);
+        }
+
+    private:
+        collection_operand<T> quantified(operand kind) const {
+            if (property().should_detect_usage_for_queries) {
+                return collection_operand<T>(property(), kind);
+            }
+            return collection_operand<T>(values(), kind);
+        }
+
+        collection_operand<T> extremum(operand kind) const {
+            if (property().should_detect_usage_for_queries) {
+                return collection_operand<T>(property(), kind);
+            }
+            auto elements = values();
+            if (elements.empty()) {
+                return collection_operand<T>(std::vector<T>(), kind);
+            }
+            auto it = kind == operand::min ? std::min_element(elements.begin(), elements.end())
+                                           : std::max_element(elements.begin(), elements.end());
+            return collection_operand<T>({*it}, kind);
+        }
+
+        std::vector<T> values() const {
+            auto detached = static_cast<const Derived&>(*this).detach();
+            std::vector<T> ret;
+            ret.reserve(detached.size());
+            if constexpr (std::is_same_v<decltype(detached), std::map<std::string, T>>) {
+                for (auto& [_, value] : detached) {
+                    ret.push_back(value);
+                }
+            } else {
+                ret.assign(detached.begin(), detached.end());
+            }
+            return ret;
+        }
+
+        const managed_base& property() const { return static_cast<const Derived&>(*this); }
+    };
+}
+
+#endif //CPPREALM_COLLECTION_QUERY_HPP
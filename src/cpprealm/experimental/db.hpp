@@ -10,6 +10,7 @@
 
 #include <cpprealm/internal/bridge/sync_session.hpp>
 #include <cpprealm/scheduler.hpp>
+#include <cpprealm/task.hpp>
 #include <cpprealm/thread_safe_reference.hpp>
 
 #include <cpprealm/experimental/macros.hpp>
@@ -20,6 +21,7 @@
 #include <optional>
 #include <string>
 #include <utility>
+#include <variant>
 
 namespace realm {
     namespace {
@@ -67,6 +69,59 @@ namespace realm::experimental {
                 commit_write();
             }
         }
+#ifdef CPPREALM_HAVE_COROUTINES
+        template <typename R>
+        struct write_awaitable {
+            internal::bridge::realm m_realm;
+            std::function<R()> m_fn;
+            std::conditional_t<std::is_void_v<R>, std::monostate, std::optional<R>> m_result;
+            std::exception_ptr m_error;
+
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(coro::coroutine_handle<> h) {
+                m_realm.async_begin_transaction([this, h] {
+                    try {
+                        if constexpr (std::is_void_v<R>) {
+                            m_fn();
+                        } else {
+                            m_result.emplace(m_fn());
+                        }
+                    } catch (...) {
+                        m_error = std::current_exception();
+                        m_realm.cancel_transaction();
+                        internal::resume_on(m_realm.scheduler(), h);
+                        return;
+                    }
+                    m_realm.async_commit_transaction([this, h](std::exception_ptr error) {
+                        m_error = std::move(error);
+                        internal::resume_on(m_realm.scheduler(), h);
+                    });
+                });
+            }
+            R await_resume() {
+                if (m_error) {
+                    std::rethrow_exception(m_error);
+                }
+                if constexpr (!std::is_void_v<R>) {
+                    return std::move(*m_result);
+                }
+            }
+        };
+
+        /**
+         Performs `fn` inside a write transaction without blocking the calling thread
+         while waiting for the write lock or for the commit to be persisted.
+
+         `co_await` the result from a coroutine running on this Realm's scheduler. The
+         coroutine is resumed on that scheduler with the value returned by `fn`, or with
+         the exception thrown by `fn` (in which case the transaction is cancelled) or by the commit.
+         */
+        template <typename Fn>
+        [[nodiscard]] write_awaitable<std::invoke_result_t<Fn>> async_write(Fn&& fn) const {
+            return {m_realm, std::forward<Fn>(fn), {}, nullptr};
+        }
+#endif
+
         template <typename U>
         managed<std::remove_const_t<U>> add(U &&v) {
             using T = std::remove_const_t<U>;
@@ -0,0 +1,122 @@
+#ifndef CPPREALM_EXPERIMENTAL_GEOSPATIAL_HPP
+#define CPPREALM_EXPERIMENTAL_GEOSPATIAL_HPP
+
+#include <cpprealm/experimental/db.hpp>
+#include <cpprealm/experimental/link.hpp>
+#include <cpprealm/experimental/macros.hpp>
+#include <cpprealm/internal/bridge/geospatial.hpp>
+#include <cpprealm/rbool.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace realm::experimental {
+    /**
+     A location on the earth, stored as an embedded object in the form read by core's
+     geospatial queries: the type `"Point"` and the coordinates `[longitude, latitude]` in
+     degrees. Objects hold locations in a link to an embedded `geo_point`, which is queried
+     with `geo_within`:
+
+         struct Venue {
+             primary_key<int64_t> _id;
+             geo_point* location = nullptr;
+         };
+         REALM_SCHEMA(Venue, _id, location)
+
+         auto nearby = realm.objects<Venue>().where([&](auto& v) {
+             return v.location.geo_within(geo_circle::from_kilometers({-73.99, 40.73}, 5));
+         });
+
+     Including this header adds `geo_point` to the schema of every Realm opened, so it should
+     only be included where a schema has a `geo_point` property.
+     */
+    struct geo_point {
+        geo_point() = default;
+        geo_point(double longitude, double latitude) : coordinates{longitude, latitude} {}
+
+        [[nodiscard]] double longitude() const { return coordinates.at(0); }
+        [[nodiscard]] double latitude() const { return coordinates.at(1); }
+
+        std::string type = "Point";
+        std::vector<double> coordinates;
+    };
+    REALM_EMBEDDED_SCHEMA(geo_point, type, coordinates)
+
+    /// The region between two corners, the south-western and north-eastern corners unless the
+    /// box crosses the antimeridian.
+    struct geo_box {
+        geo_point lower_left;
+        geo_point upper_right;
+
+        operator internal::bridge::geospatial() const { //NOLINT(google-explicit-constructor)
+            return internal::bridge::geospatial::box({lower_left.longitude(), lower_left.latitude()},
+                                                     {upper_right.longitude(), upper_right.latitude()});
+        }
+    };
+
+    /// The region within a distance of a center, measured along the surface of the earth.
+    struct geo_circle {
+        geo_point center;
+        double radius_radians = 0;
+
+        /// A circle with a radius in kilometers, using the equatorial radius of the earth, as core does.
+        static geo_circle from_kilometers(geo_point center, double radius_kilometers) {
+            return {std::move(center), radius_kilometers / 6378.1};
+        }
+
+        operator internal::bridge::geospatial() const { //NOLINT(google-explicit-constructor)
+            return internal::bridge::geospatial::circle({center.longitude(), center.latitude()}, radius_radians);
+        }
+    };
+
+    /// The region within a closed ring of points, excluding the regions within any holes. Each
+    /// ring repeats its first point at the end.
+    struct geo_polygon {
+        std::vector<geo_point> outer_ring;
+        std::vector<std::vector<geo_point>> holes;
+
+        operator internal::bridge::geospatial() const { //NOLINT(google-explicit-constructor)
+            std::vector<std::vector<internal::bridge::geospatial::point>> rings;
+            rings.reserve(holes.size() + 1);
+            auto append = [&rings](const std::vector<geo_point>& ring) {
+                auto& points = rings.emplace_back();
+                points.reserve(ring.size());
+                for (auto& p : ring) {
+                    points.push_back({p.longitude(), p.latitude()});
+                }
+            };
+            append(outer_ring);
+            for (auto& hole : holes) {
+                append(hole);
+            }
+            return internal::bridge::geospatial::polygon(std::move(rings));
+        }
+    };
+
+    /**
+     The condition of `managed<geo_point*>::geo_within`. Within a query it is evaluated by core's
+     geospatial query support, otherwise on the detached location. Objects without a location
+     never match.
+     */
+    template <typename Region>
+    rbool location_within(const managed<geo_point*>& location, const Region& region) {
+        internal::bridge::geospatial bounds = region;
+        if (location.should_detect_usage_for_queries) {
+            auto query = internal::bridge::query(location.query->get_table());
+            query.geo_within(location.m_key, bounds);
+            return rbool(std::move(query));
+        }
+        if (location.m_obj->is_null(location.m_key)) {
+            return false;
+        }
+        std::unique_ptr<geo_point> point(location.detach());
+        if (point->coordinates.size() < 2) {
+            return false;
+        }
+        return bounds.contains({point->longitude(), point->latitude()});
+    }
+}
+
+#endif //CPPREALM_EXPERIMENTAL_GEOSPATIAL_HPP
@@ -5,10 +5,16 @@
 #include <cpprealm/experimental/macros.hpp>
 #include <cpprealm/experimental/accessors.hpp>
 
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
 namespace realm {
     namespace experimental {
         template <typename, typename>
         struct managed;
+        struct geo_point;
 
         template<typename T>
         struct managed<T*> : managed_base {
@@ -64,13 +70,35 @@ namespace realm {
                     return !this->operator==(rhs);
                 }
             };
-            ref_type operator ->() const {
+            void assign(internal::bridge::obj *obj,
+                        internal::bridge::realm* realm,
+                        const internal::bridge::col_key &key) {
+                m_target.reset();
+                m_column_plan.reset();
+                managed_base::assign(obj, realm, key);
+            }
+
+            /**
+             Accesses the object this link points to. The accessor for the target is kept and
+             reused for as long as the link points at the same object, so chained access such as
+             `a->b->name` only reads the link's key on each hop. The column keys of every property
+             of the target are resolved together, once per link, on the first access.
+             */
+            managed<T>* operator ->() const {
                 if (should_detect_usage_for_queries) {
-                    managed<T> m = managed<T>::prepare_for_query(*m_realm);
-                    return {std::move(m)};
+                    if (!m_target) {
+                        m_target = std::make_shared<managed<T>>(managed<T>::prepare_for_query(*m_realm));
+                    }
+                    return m_target.get();
                 }
-                managed<T> m(m_obj->get_linked_object(m_key), *m_realm);
-                return {std::move(m)};
+                auto key = m_obj->get_linked_key(m_key);
+                if (!m_target || m_target->m_obj.get_key() != key) {
+                    if (!m_column_plan) {
+                        m_column_plan = managed<T>::column_plan(m_obj->get_target_table(m_key));
+                    }
+                    m_target = std::make_shared<managed<T>>(m_obj->get_linked_object(m_key), *m_realm, *m_column_plan);
+                }
+                return m_target.get();
             }
             operator bool() {
                 if (m_obj && m_key) {
@@ -127,13 +155,13 @@ namespace realm {
             bool operator ==(const managed<T>& rhs) const {
                 if (*this->m_realm != rhs.m_realm)
                     return false;
-                return m_obj->get_linked_object(m_key).get_key() == rhs.m_obj.get_key();
+                return m_obj->get_linked_key(m_key) == rhs.m_obj.get_key();
             }
 
             bool operator ==(const managed<T*>& rhs) const {
                 if (*this->m_realm != *rhs.m_realm)
                     return false;
-                return m_obj->get_linked_object(m_key).get_key() == rhs.m_obj->get_key();
+                return m_obj->get_linked_key(m_key) == rhs.m_obj->get_key();
             }
 
             bool operator !=(const std::nullptr_t) const {
@@ -146,6 +174,21 @@ namespace realm {
             bool operator !=(const managed<T*>& rhs) const {
                 return !this->operator==(rhs);
             }
+
+            /**
+             Matches objects whose location, the embedded `geo_point` this link points to, lies
+             within `region`, a `geo_box`, `geo_circle` or `geo_polygon`. Requires the geospatial
+             types from <cpprealm/experimental/geospatial.hpp>.
+             */
+            template <typename Region>
+            auto geo_within(const Region& region) const {
+                static_assert(std::is_same_v<T, geo_point>, "geo_within() requires a link to an embedded geo_point");
+                return location_within(*this, region);
+            }
+
+        private:
+            mutable std::shared_ptr<managed<T>> m_target;
+            mutable std::optional<std::vector<internal::bridge::col_key>> m_column_plan;
         };
     }
 }
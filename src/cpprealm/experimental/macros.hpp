@@ -130,6 +130,10 @@
 #define DECLARE_COND_PROPERTY_VALUE_FOR_NAME(cls, p) if (_name == #p) { auto ptr = &managed<cls>::p; return (*this.*ptr).detach(); }
 #define DECLARE_COND_UNMANAGED_TO_MANAGED(cls, p) if constexpr (std::is_same_v<decltype(ptr), decltype(&cls::p)>) { return &managed<cls>::p; }
 
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
 #include <utility>
 
 #define COUNTER_READ_CRUMB( TAG, RANK, ACC ) \
@@ -153,6 +157,7 @@ constexpr constant_index< acc > counter_crumb( id, constant_index< rank >, const
 #include <cpprealm/internal/bridge/object.hpp>
 #include <cpprealm/internal/bridge/realm.hpp>
 #include <cpprealm/internal/bridge/col_key.hpp>
+#include <cpprealm/internal/bridge/mixed.hpp>
 #include <cpprealm/internal/bridge/obj.hpp>
 #include <cpprealm/internal/bridge/property.hpp>
 #include <cpprealm/internal/bridge/query.hpp>
@@ -241,14 +246,62 @@ namespace realm::experimental {
             query = &query_builder;
         }
 
+        // Binds this property to `query_builder`, which is owned by the query-mode accessor of
+        // the object the property belongs to and so lives as long as the property.
         void prepare_for_query(internal::bridge::realm* realm,
-                               const internal::bridge::table& table,
+                               internal::bridge::query& query_builder,
                                const std::string_view& col_name) {
-            this->query = new internal::bridge::query(table);
+            this->query = &query_builder;
             this->m_realm = realm;
-            this->m_key = table.get_column_key(col_name);
+            this->m_key = query_builder.get_table().get_column_key(col_name);
             this->should_detect_usage_for_queries = true;
         }
+
+    protected:
+        // Builds the query matching objects whose value for this property is any of `values`,
+        // each converted to a query argument by `to_mixed`.
+        template<typename Range, typename ToMixed>
+        internal::bridge::query query_for_any_of(const Range& values, ToMixed&& to_mixed) const {
+            std::vector<internal::bridge::mixed> arguments;
+            for (const auto& v : values) {
+                arguments.push_back(to_mixed(v));
+            }
+            auto query = internal::bridge::query(this->query->get_table());
+            query.in(m_key, arguments);
+            return query;
+        }
+
+        template<typename Range, typename Value>
+        static bool is_any_of(const Range& values, const Value& value) {
+            return std::any_of(std::begin(values), std::end(values), [&](const auto& v) { return v == value; });
+        }
+    };
+
+    /**
+     Common state of managed collection properties. The bridge collection is created on first
+     use and kept for subsequent operations instead of being looked up for every call. It is
+     recreated if the property is rebound to another object or the collection becomes invalid;
+     the collection itself follows new versions of the Realm.
+     */
+    template <typename Collection>
+    struct managed_collection_base : managed_base {
+        void assign(internal::bridge::obj *obj,
+                    internal::bridge::realm* realm,
+                    const internal::bridge::col_key &key) {
+            m_collection.reset();
+            managed_base::assign(obj, realm, key);
+        }
+
+    protected:
+        Collection& collection() const {
+            if (!m_collection || !m_collection->is_valid()) {
+                m_collection.emplace(*m_realm, *m_obj, m_key);
+            }
+            return *m_collection;
+        }
+
+    private:
+        mutable std::optional<Collection> m_collection;
     };
 
     template<typename T, typename = void>
@@ -315,6 +368,8 @@ rbool managed<std::optional<type>>::operator op(const std::optional<type>& rhs)
         internal::bridge::obj m_obj;\
         internal::bridge::realm m_realm;                                                           \
         bool m_prepare_for_query = false;                                                           \
+        /* The query builder of a query-mode accessor, which its properties refer to. */          \
+        std::optional<internal::bridge::query> m_query_builder;                                    \
         explicit managed(const internal::bridge::obj& obj,                 \
                          internal::bridge::realm realm)                  \
         : m_obj(std::move(obj))\
@@ -326,19 +381,34 @@ rbool managed<std::optional<type>>::operator op(const std::optional<type>& rhs)
                 }, managed_pointers_names); \
             }, managed_pointers()); \
         }                                                                                          \
+        using column_plan_type = std::vector<internal::bridge::col_key>;                           \
+        /* Resolves the column keys of every property once, for binding many objects of the table. */ \
+        static column_plan_type column_plan(const internal::bridge::table& table) {                \
+            column_plan_type plan;                                                                 \
+            plan.reserve(managed_pointers_names.size());                                           \
+            for (auto& name : managed_pointers_names) {                                            \
+                plan.push_back(table.get_column_key(name));                                        \
+            }                                                                                      \
+            return plan;                                                                           \
+        }                                                                                          \
+        managed(const internal::bridge::obj& obj,                                                  \
+                internal::bridge::realm realm,                                                     \
+                const column_plan_type& plan)                                                      \
+        : m_obj(obj)                                                                               \
+        , m_realm(std::move(realm))                                                                \
+        {                                                                                          \
+            std::apply([&](auto && ...ptr) {                                                       \
+                size_t i = 0;                                                                      \
+                ((*this.*ptr).assign(&m_obj, &m_realm, plan[i++]), ...);                           \
+            }, managed_pointers());                                                                \
+        }                                                                                          \
         managed(const managed& other) { \
             m_obj = other.m_obj; \
             m_realm = other.m_realm;                                                               \
             m_prepare_for_query = other.m_prepare_for_query;                                     \
             if (m_prepare_for_query) {                                                                                       \
-                auto schema = m_realm.schema().find(other.schema.name);                                  \
-                auto group = m_realm.read_group();                                                   \
-                auto table_ref = group.get_table(schema.table_key());                                  \
-                std::apply([&](auto &&...ptr) {                                                        \
-                    std::apply([&](auto &&..._name) {                                                   \
-                        ((*this.*ptr).prepare_for_query(&m_realm, table_ref, _name), ...);                \
-                    }, managed_pointers_names);                                                         \
-                }, managed_pointers());                                                                 \
+                m_query_builder = other.m_query_builder;                                           \
+                bind_properties_for_query();                                                       \
             } else {                                                                                      \
                 std::apply([&](auto &&...ptr) { \
                     std::apply([&](auto &&..._name) { \
@@ -352,15 +422,10 @@ rbool managed<std::optional<type>>::operator op(const std::optional<type>& rhs)
             m_realm = other.m_realm;                                                               \
             m_prepare_for_query = other.m_prepare_for_query;                                     \
              if (m_prepare_for_query) {                                                                                       \
-                 auto schema = m_realm.schema().find(other.schema.name);                                  \
-                 auto group = m_realm.read_group();                                                   \
-                 auto table_ref = group.get_table(schema.table_key());                                  \
-                 std::apply([&](auto &&...ptr) {                                                        \
-                     std::apply([&](auto &&..._name) {                                                   \
-                         ((*this.*ptr).prepare_for_query(&m_realm, table_ref, _name), ...);                \
-                     }, managed_pointers_names);                                                         \
-                 }, managed_pointers());                                                                 \
+                 m_query_builder = other.m_query_builder;                                          \
+                 bind_properties_for_query();                                                      \
              } else {                                                                                      \
+                 m_query_builder.reset();                                                          \
                  std::apply([&](auto &&...ptr) { \
                      std::apply([&](auto &&..._name) { \
                      ((*this.*ptr).assign(&m_obj, &m_realm, m_obj.get_table().get_column_key(_name)), ...); \
@@ -374,14 +439,8 @@ rbool managed<std::optional<type>>::operator op(const std::optional<type>& rhs)
             m_realm = std::move(other.m_realm);                                                    \
             m_prepare_for_query = std::move(other.m_prepare_for_query);                                     \
              if (m_prepare_for_query) {                                                                                       \
-                 auto schema = m_realm.schema().find(other.schema.name);                                  \
-                 auto group = m_realm.read_group();                                                   \
-                 auto table_ref = group.get_table(schema.table_key());                                  \
-                 std::apply([&](auto &&...ptr) {                                                        \
-                     std::apply([&](auto &&..._name) {                                                   \
-                         ((*this.*ptr).prepare_for_query(&m_realm, table_ref, _name), ...);                \
-                     }, managed_pointers_names);                                                         \
-                 }, managed_pointers());                                                                 \
+                 m_query_builder = std::move(other.m_query_builder);                               \
+                 bind_properties_for_query();                                                      \
              } else {                                                                                      \
                  std::apply([&](auto &&...ptr) { \
                      std::apply([&](auto &&..._name) { \
@@ -395,15 +454,10 @@ rbool managed<std::optional<type>>::operator op(const std::optional<type>& rhs)
             m_realm = std::move(other.m_realm);                                                   \
             m_prepare_for_query = std::move(other.m_prepare_for_query);                                     \
             if (m_prepare_for_query) {                                                                                       \
-                auto schema = m_realm.schema().find(other.schema.name);                                  \
-                auto group = m_realm.read_group();                                                   \
-                auto table_ref = group.get_table(schema.table_key());                                  \
-                std::apply([&](auto &&...ptr) {                                                        \
-                   std::apply([&](auto &&..._name) {                                                   \
-                     ((*this.*ptr).prepare_for_query(&m_realm, table_ref, _name), ...);                \
-                   }, managed_pointers_names);                                                         \
-                }, managed_pointers());                                                                 \
+                m_query_builder = std::move(other.m_query_builder);                                \
+                bind_properties_for_query();                                                       \
                 } else {                                                                                      \
+                   m_query_builder.reset();                                                        \
                    std::apply([&](auto &&...ptr) { \
                         std::apply([&](auto &&..._name) { \
                         ((*this.*ptr).assign(&m_obj, &m_realm, m_obj.get_table().get_column_key(_name)), ...); \
@@ -418,13 +472,18 @@ rbool managed<std::optional<type>>::operator op(const std::optional<type>& rhs)
             m.m_realm = r;                                                                         \
             auto schema = m.m_realm.schema().find(m.schema.name);                                  \
             auto group = m.m_realm.read_group();                                                   \
-            auto table_ref = group.get_table(schema.table_key());                                  \
+            m.m_query_builder.emplace(group.get_table(schema.table_key()));                        \
+            m.bind_properties_for_query();                                                         \
+            return m;                                                                               \
+        }                                                                                           \
+        /* Binds every property to the query builder owned by this accessor, which is freed */    \
+        /* with it, rather than allocating state for each property. */                            \
+        void bind_properties_for_query() {                                                          \
             std::apply([&](auto && ...ptr) {                                                        \
                 std::apply([&](auto&& ..._name) {                                                   \
-                    ((m.*ptr).prepare_for_query(&m.m_realm, table_ref, _name), ...);                \
+                    ((*this.*ptr).prepare_for_query(&m_realm, *m_query_builder, _name), ...);       \
                 }, managed_pointers_names);                                                         \
             }, managed_pointers());                                                                 \
-            return m;                                                                               \
         }                                                                                           \
         cls detach() const {                                                                        \
             cls v;                                                                                  \
@@ -444,6 +503,13 @@ rbool managed<std::optional<type>>::operator op(const std::optional<type>& rhs)
             return m_object->add_notification_callback( \
             std::make_shared<realm::experimental::ObjectChangeCallbackWrapper<managed>>(wrapper));                               \
         }                      \
+        auto observe(std::function<void(realm::experimental::object_change<managed>&&)>&& fn, \
+                     const std::vector<realm::experimental::property_key_path<cls>>& key_paths) { \
+            auto m_object = std::make_shared<internal::bridge::object>(m_realm, m_obj);                   \
+            auto paths = realm::experimental::property_key_path<cls>::to_key_path_array(m_obj.get_table(), key_paths); \
+            return m_object->add_notification_callback( \
+            std::make_shared<realm::experimental::ObjectChangeCallbackWrapper<managed>>(std::move(fn), this, m_object), paths); \
+        }                      \
         bool operator ==(const managed<cls>& other) const {                                                               \
             auto& a = m_obj; \
             auto& b = other.m_obj; \
@@ -1,6 +1,8 @@
 #include <cpprealm/experimental/managed_binary.hpp>
 #include <cpprealm/rbool.hpp>
 
+#include <stdexcept>
+
 namespace realm::experimental {
     std::vector<uint8_t> managed<std::vector<uint8_t>>::detach() const {
         return m_obj->template get<realm::internal::bridge::binary>(m_key);
@@ -20,12 +22,24 @@ namespace realm::experimental {
         m_obj->template set<internal::bridge::binary>(m_key, v2);
     }
 
-    uint8_t managed<std::vector<uint8_t>>::operator[](uint8_t idx) const {
-        return m_obj->template get<internal::bridge::binary>(m_key)[idx];
+    uint8_t managed<std::vector<uint8_t>>::operator[](size_t idx) const {
+        uint8_t v = 0;
+        if (m_obj->read_binary(m_key, idx, &v, 1) == 0) {
+            throw std::out_of_range("Index out of range.");
+        }
+        return v;
     }
 
     size_t managed<std::vector<uint8_t>>::size() const {
-        return m_obj->template get<internal::bridge::binary>(m_key).size();
+        return m_obj->get_binary_size(m_key);
+    }
+
+    blob_reader managed<std::vector<uint8_t>>::open_read(size_t offset) const {
+        return blob_reader(*m_obj, m_key, offset);
+    }
+
+    blob_writer managed<std::vector<uint8_t>>::open_write() {
+        return blob_writer(*m_obj, m_key);
     }
 
     __cpprealm_build_experimental_query(==, equal, std::vector<uint8_t>);
@@ -50,13 +64,24 @@ namespace realm::experimental {
 
     }
 
-    uint8_t managed<std::optional<std::vector<uint8_t>>>::box::operator[](uint8_t idx) const {
-        auto b = m_parent.get().m_obj->get_optional<internal::bridge::binary>(m_parent.get().m_key);
-        return b->operator[](idx);
+    uint8_t managed<std::optional<std::vector<uint8_t>>>::box::operator[](size_t idx) const {
+        uint8_t v = 0;
+        if (m_parent.get().m_obj->read_binary(m_parent.get().m_key, idx, &v, 1) == 0) {
+            throw std::out_of_range("Index out of range.");
+        }
+        return v;
     }
 
     size_t managed<std::optional<std::vector<uint8_t>>>::box::size() const {
-        return m_parent.get().m_obj->template get<internal::bridge::binary>(m_parent.get().m_key).size();
+        return m_parent.get().m_obj->get_binary_size(m_parent.get().m_key);
+    }
+
+    blob_reader managed<std::optional<std::vector<uint8_t>>>::open_read(size_t offset) const {
+        return blob_reader(*m_obj, m_key, offset);
+    }
+
+    blob_writer managed<std::optional<std::vector<uint8_t>>>::open_write() {
+        return blob_writer(*m_obj, m_key);
     }
 
     __cpprealm_build_optional_experimental_query(==, equal, std::vector<uint8_t>);
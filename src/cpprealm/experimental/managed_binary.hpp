@@ -1,6 +1,7 @@
 #ifndef CPPREALM_MANAGED_BINARY_HPP
 #define CPPREALM_MANAGED_BINARY_HPP
 
+#include <cpprealm/experimental/blob_stream.hpp>
 #include <cpprealm/experimental/macros.hpp>
 #include <cpprealm/experimental/types.hpp>
 
@@ -19,9 +20,14 @@ namespace realm::experimental {
 
         std::vector<uint8_t> operator*() const;
         void push_back(uint8_t v);
-        uint8_t operator[](uint8_t idx) const;
+        uint8_t operator[](size_t idx) const;
         size_t size() const;
 
+        /// Opens a stream reading the value from `offset` in chunks, without copying all of it.
+        [[nodiscard]] blob_reader open_read(size_t offset = 0) const;
+        /// Opens a stream replacing the value, which is stored when the stream is closed.
+        [[nodiscard]] blob_writer open_write();
+
         //MARK: -   comparison operators
         rbool operator==(const std::vector<uint8_t>& rhs) const noexcept;
         rbool operator!=(const std::vector<uint8_t>& rhs) const noexcept;
@@ -37,7 +43,7 @@ namespace realm::experimental {
         struct box {
             std::optional<std::vector<uint8_t>> operator*() const;
             void push_back(uint8_t v);
-            uint8_t operator[](uint8_t idx) const;
+            uint8_t operator[](size_t idx) const;
             size_t size() const;
         private:
             box(managed& parent) : m_parent(parent) { }
@@ -45,6 +51,12 @@ namespace realm::experimental {
             friend struct managed<std::optional<std::vector<uint8_t>>>;
         };
 
+        /// Opens a stream reading the value from `offset` in chunks, without copying all of it.
+        /// A null value reads as empty.
+        [[nodiscard]] blob_reader open_read(size_t offset = 0) const;
+        /// Opens a stream replacing the value, which is stored when the stream is closed.
+        [[nodiscard]] blob_writer open_write();
+
         std::unique_ptr<box> operator->()
         {
             return std::make_unique<box>(box(*this));
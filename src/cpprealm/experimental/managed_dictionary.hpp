@@ -3,6 +3,7 @@
 
 #include <cpprealm/experimental/macros.hpp>
 #include <cpprealm/experimental/accessors.hpp>
+#include <cpprealm/experimental/collection_query.hpp>
 #include <cpprealm/experimental/observation.hpp>
 #include <cpprealm/notifications.hpp>
 
@@ -11,7 +12,7 @@ namespace realm::experimental {
     template<typename mapped_type>
     struct box_base {
         box_base(internal::bridge::core_dictionary &&backing_map,
-                 const std::string &key,
+                 std::string_view key,
                  const internal::bridge::realm &r)
             : m_backing_map(std::move(backing_map)), m_key(key), m_realm(r) {}
 
@@ -465,7 +466,8 @@ namespace realm::experimental {
     };
 
     template<typename T>
-    struct managed<std::map<std::string, T>, void> : managed_base {
+    struct managed<std::map<std::string, T>, void>
+        : managed_collection_base<internal::bridge::dictionary>, collection_query_operators<managed<std::map<std::string, T>>, T> {
         using managed<std::map<std::string, T>>::managed_base::operator=;
 
         [[nodiscard]] std::map<std::string, T> detach() const {
@@ -524,8 +526,8 @@ namespace realm::experimental {
 
             std::pair<std::string, T> operator*() noexcept
             {
-                auto pair = m_parent->m_obj->get_dictionary(m_parent->m_key).get_pair(m_i);
-                return { pair.first, deserialize<T>(pair.second) };
+                auto pair = m_parent->collection().get_entry(m_i);
+                return { std::string(pair.first), deserialize<T>(pair.second) };
             }
 
             iterator& operator++()
@@ -551,9 +553,159 @@ namespace realm::experimental {
             const managed<std::map<std::string, T>>* m_parent;
         };
 
+        /// Iterates the dictionary's entries without copying the keys.
+        /// The keys are views into the Realm and are only valid until the next write
+        /// or refresh; copy them into a `std::string` to keep them longer.
+        class entry_iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = std::pair<std::string_view, T>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = value_type*;
+            using reference = value_type;
+
+            bool operator!=(const entry_iterator& other) const
+            {
+                return !(*this == other);
+            }
+
+            bool operator==(const entry_iterator& other) const
+            {
+                return (m_parent == other.m_parent) && (m_i == other.m_i);
+            }
+
+            value_type operator*() const
+            {
+                auto pair = m_parent->collection().get_entry(m_i);
+                return { pair.first, deserialize<T>(pair.second) };
+            }
+
+            entry_iterator& operator++()
+            {
+                this->m_i++;
+                return *this;
+            }
+        private:
+            template<typename, typename>
+            friend struct managed;
+
+            entry_iterator(size_t i, const managed<std::map<std::string, T>>* parent)
+                : m_i(i), m_parent(parent)
+            {
+            }
+            size_t m_i;
+            const managed<std::map<std::string, T>>* m_parent;
+        };
+
+        struct entry_range {
+            entry_iterator begin() const { return entry_iterator(0, m_parent); }
+            entry_iterator end() const { return entry_iterator(m_parent->size(), m_parent); }
+            const managed<std::map<std::string, T>>* m_parent;
+        };
+
+        [[nodiscard]] entry_range entries() const
+        {
+            return entry_range{this};
+        }
+
         size_t size() const
         {
-            return m_obj->get_dictionary(m_key).size();
+            return collection().size();
+        }
+
+        [[nodiscard]] bool contains(std::string_view key) const
+        {
+            return collection().contains(key);
+        }
+
+        /// Returns the value for `key`, or `std::nullopt` if the dictionary has no such key.
+        [[nodiscard]] std::optional<T> get(std::string_view key) const
+        {
+            static_assert(!std::is_pointer_v<T>, "Use operator[] to access links in a dictionary.");
+            if (auto v = collection().try_get(key)) {
+                return deserialize<T>(*v);
+            }
+            return std::nullopt;
+        }
+
+        /// Looks up every key in `keys` in a single pass over the dictionary. The result
+        /// has one entry per key, in order, which is `std::nullopt` where the key is absent.
+        template<typename Keys>
+        [[nodiscard]] std::vector<std::optional<T>> get_many(const Keys& keys) const
+        {
+            static_assert(!std::is_pointer_v<T>, "Use operator[] to access links in a dictionary.");
+            std::vector<std::string_view> views;
+            for (const auto& key : keys) {
+                views.emplace_back(key);
+            }
+            std::vector<std::optional<internal::bridge::mixed>> values;
+            collection().get_many(views, values);
+
+            std::vector<std::optional<T>> ret;
+            ret.reserve(values.size());
+            for (auto& v : values) {
+                if (v) {
+                    ret.emplace_back(deserialize<T>(*v));
+                } else {
+                    ret.emplace_back(std::nullopt);
+                }
+            }
+            return ret;
+        }
+
+        [[nodiscard]] std::vector<std::optional<T>> get_many(std::initializer_list<std::string_view> keys) const
+        {
+            return get_many<std::initializer_list<std::string_view>>(keys);
+        }
+
+        /// Inserts or overwrites every key/value pair in `values`.
+        template<typename Pairs>
+        void insert_many(const Pairs& values)
+        {
+            if constexpr (std::is_pointer_v<T>) {
+                for (const auto& [key, value] : values) {
+                    (*this)[key] = value;
+                }
+            } else {
+                std::vector<std::pair<std::string_view, internal::bridge::mixed>> entries;
+                for (const auto& [key, value] : values) {
+                    entries.emplace_back(std::string_view(key), to_mixed(value));
+                }
+                collection().insert_many(entries);
+            }
+        }
+
+        void insert_many(std::initializer_list<std::pair<std::string_view, T>> values)
+        {
+            insert_many<std::initializer_list<std::pair<std::string_view, T>>>(values);
+        }
+
+        /// The keys of the dictionary in a query, which match if any key satisfies the
+        /// comparison, e.g. `o.map_int_col.keys() == "a"`.
+        [[nodiscard]] collection_operand<std::string> keys() const
+        {
+            if (this->should_detect_usage_for_queries) {
+                return collection_operand<std::string>(*this, internal::bridge::query::collection_operand::keys);
+            }
+            std::vector<std::string> ret;
+            for (auto& [key, _] : detach()) {
+                ret.push_back(key);
+            }
+            return collection_operand<std::string>(std::move(ret), internal::bridge::query::collection_operand::keys);
+        }
+
+        /// The value for `key` in a query, which matches no comparison if the key is absent,
+        /// e.g. `o.map_int_col.for_key("a") > 1`.
+        [[nodiscard]] collection_operand<T> for_key(const std::string& key) const
+        {
+            if (this->should_detect_usage_for_queries) {
+                return collection_operand<T>(*this, internal::bridge::query::collection_operand::entry, key);
+            }
+            std::vector<T> ret;
+            if (auto v = get(key)) {
+                ret.push_back(*v);
+            }
+            return collection_operand<T>(std::move(ret), internal::bridge::query::collection_operand::entry);
         }
 
         iterator begin() const
@@ -566,10 +718,9 @@ namespace realm::experimental {
             return iterator(size(), this);
         }
 
-        iterator find(const std::string& key) {
+        iterator find(std::string_view key) {
             // Dictionary's `find` searches for the index of the value and not the key.
-            auto d = m_obj->get_dictionary(m_key);
-            auto i = d.find_any_key(key);
+            auto i = collection().find_any_key(key);
             if (i == size_t(-1)) {
                 return iterator(size(), this);
             } else {
@@ -577,16 +728,16 @@ namespace realm::experimental {
             }
         }
 
-        box<std::conditional_t<std::is_pointer_v<T>, managed<T>, T>>  operator[](const std::string &a) {
+        box<std::conditional_t<std::is_pointer_v<T>, managed<T>, T>>  operator[](std::string_view a) {
             if constexpr (std::is_pointer_v<T>) {
-                return box<managed<T>>(m_obj->get_dictionary(m_key), a, *m_realm);
+                return box<managed<T>>(collection(), a, *m_realm);
             } else {
-                return box<T>(m_obj->get_dictionary(m_key), a, *m_realm);
+                return box<T>(collection(), a, *m_realm);
             }
         }
 
-        void erase(const std::string& key) {
-            m_obj->get_dictionary(m_key).erase(key);
+        void erase(std::string_view key) {
+            collection().erase(key);
         }
 
 
@@ -600,6 +751,43 @@ namespace realm::experimental {
             token.m_dictionary = dict;
             return token;
         }
+
+        /// Observes the dictionary, reporting changed keys as `std::string_view`s into the
+        /// dictionary rather than copies. The change is only valid for the duration of the callback.
+        notification_token observe_keys(std::function<void(realm::dictionary_key_change)>&& fn)
+        {
+            auto dict = std::make_shared<realm::internal::bridge::dictionary>(*m_realm, *m_obj, m_key);
+            realm::notification_token token = dict->add_key_based_notification_callback(
+                                                std::make_shared<realm::dictionary_key_callback_wrapper>(std::move(fn)));
+            token.m_realm = *m_realm;
+            token.m_dictionary = dict;
+            return token;
+        }
+
+        /// Observes the dictionary, reporting changes as ranges of entry indices. No keys are
+        /// looked up, so listeners which only need to know how much changed should prefer this,
+        /// e.g. `change.insertions.count()`.
+        notification_token observe_ranges(std::function<void(collection_range_change)>&& fn)
+        {
+            auto dict = std::make_shared<realm::internal::bridge::dictionary>(*m_realm, *m_obj, m_key);
+            realm::notification_token token = dict->add_notification_callback(
+                    std::make_shared<collection_callback_wrapper>(std::move(fn), false));
+            token.m_realm = *m_realm;
+            token.m_dictionary = dict;
+            return token;
+        }
+
+    private:
+        // Strings are referenced rather than copied, so `v` must outlive the returned value.
+        internal::bridge::mixed to_mixed(const T& v) const {
+            if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::optional<std::string>>) {
+                return internal::bridge::mixed(v);
+            } else if constexpr (internal::type_info::MixedPersistableConcept<T>::value) {
+                return serialize(v, *m_realm);
+            } else {
+                return internal::bridge::mixed(serialize(v));
+            }
+        }
     };
 
 } // namespace realm::experimental
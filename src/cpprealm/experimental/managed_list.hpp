@@ -2,19 +2,42 @@
 #define CPPREALM_MANAGED_LIST_HPP
 
 #include <cpprealm/notifications.hpp>
+#include <cpprealm/experimental/blob_stream.hpp>
+#include <cpprealm/experimental/collection_query.hpp>
 #include <cpprealm/experimental/macros.hpp>
 #include <cpprealm/experimental/types.hpp>
 #include <cpprealm/experimental/observation.hpp>
 
+#include <array>
+#include <stdexcept>
+
 namespace realm::experimental {
 
+    using managed_list_base = managed_collection_base<internal::bridge::list>;
+
     template<typename T>
-    struct managed<std::vector<T>, std::enable_if_t<internal::type_info::is_primitive<T>::value>> : managed_base {
+    struct managed<std::vector<T>, std::enable_if_t<internal::type_info::is_primitive<T>::value>>
+        : managed_list_base, collection_query_operators<managed<std::vector<T>>, T> {
         using managed<std::vector<T>>::managed_base::operator=;
-
+        using managed_list_base::assign;
+        using internal_type = typename internal::type_info::type_info<T>::internal_type;
+
+        /**
+         A random access iterator over the values of the list. Values are fetched through
+         the bridge in batches of `block_size` elements, which are shared between copies of
+         the iterator, so iterating fetches each batch once. The Realm still reads the
+         values of a batch one at a time. Like the iterators of standard containers,
+         iterators are invalidated by writes to the list.
+         */
         class iterator {
         public:
-            using iterator_category = std::input_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = T;
+            using pointer = void;
+            using reference = T;
+            using iterator_category = std::random_access_iterator_tag;
+
+            static constexpr size_t block_size = 1024;
 
             bool operator!=(const iterator& other) const
             {
@@ -26,9 +49,29 @@ namespace realm::experimental {
                 return (m_parent == other.m_parent) && (m_i == other.m_i);
             }
 
-            T operator*() const noexcept
+            bool operator<(const iterator& other) const { return m_i < other.m_i; }
+            bool operator>(const iterator& other) const { return m_i > other.m_i; }
+            bool operator<=(const iterator& other) const { return m_i <= other.m_i; }
+            bool operator>=(const iterator& other) const { return m_i >= other.m_i; }
+
+            T operator*() const
             {
-                return (*m_parent)[m_i];
+                if (!m_block) {
+                    m_block = std::make_shared<block>();
+                }
+                if (m_i < m_block->begin || m_i >= m_block->begin + m_block->values.size()) {
+                    m_block->begin = m_i - m_i % block_size;
+                    auto& list = m_parent->collection();
+                    internal::bridge::get_range(list, m_block->begin,
+                                                std::min(m_block->begin + block_size, list.size()),
+                                                m_block->values);
+                }
+                return m_parent->deserialize_value(internal_type(m_block->values[m_i - m_block->begin]));
+            }
+
+            T operator[](difference_type n) const
+            {
+                return *(*this + n);
             }
 
             iterator& operator++()
@@ -42,16 +85,57 @@ namespace realm::experimental {
                 this->m_i += i;
                 return *this;
             }
+
+            iterator& operator--()
+            {
+                this->m_i--;
+                return *this;
+            }
+
+            iterator& operator+=(difference_type n)
+            {
+                this->m_i += n;
+                return *this;
+            }
+
+            iterator& operator-=(difference_type n)
+            {
+                this->m_i -= n;
+                return *this;
+            }
+
+            iterator operator+(difference_type n) const
+            {
+                iterator it = *this;
+                return it += n;
+            }
+
+            iterator operator-(difference_type n) const
+            {
+                iterator it = *this;
+                return it -= n;
+            }
+
+            difference_type operator-(const iterator& other) const
+            {
+                return static_cast<difference_type>(m_i) - static_cast<difference_type>(other.m_i);
+            }
         private:
             template<typename, typename>
             friend struct managed;
 
+            struct block {
+                size_t begin = 0;
+                std::vector<internal_type> values;
+            };
+
             iterator(size_t i, managed<std::vector<T>>* parent)
                 : m_i(i), m_parent(parent)
             {
             }
             size_t m_i;
             managed<std::vector<T>>* m_parent;
+            mutable std::shared_ptr<block> m_block;
         };
         iterator begin()
         {
@@ -63,23 +147,18 @@ namespace realm::experimental {
             return iterator(size(), this);
         }
         [[nodiscard]] std::vector<T> detach() const {
-            auto list = realm::internal::bridge::list(*m_realm, *m_obj, m_key);
-            using U = typename internal::type_info::type_info<T>::internal_type;
+            auto& list = collection();
 
             size_t count = list.size();
             if (count == 0)
                 return std::vector<T>();
 
+            std::vector<internal_type> values;
+            realm::internal::bridge::get_range(list, 0, count, values);
             auto ret = std::vector<T>();
             ret.reserve(count);
-            for(size_t i = 0; i < count; i++) {
-                if constexpr (internal::type_info::MixedPersistableConcept<T>::value) {
-                    ret.push_back(deserialize<T>(realm::internal::bridge::get<U>(list, i)));
-                } else if constexpr (std::is_enum_v<T>) {
-                    ret.push_back(deserialize<T>(realm::internal::bridge::get<U>(list, i)));
-                } else {
-                    ret.push_back(deserialize(realm::internal::bridge::get<U>(list, i)));
-                }
+            for (auto&& value : values) {
+                ret.push_back(deserialize_value(internal_type(value)));
             }
 
             return ret;
@@ -96,66 +175,148 @@ namespace realm::experimental {
             return std::move(token);
         }
 
+        // Observe this list with change sets given as index ranges, see `collection_range_change`.
+        realm::notification_token observe_ranges(std::function<void(realm::experimental::collection_range_change)>&& fn) {
+            auto list = std::make_shared<realm::internal::bridge::list>(*m_realm, *m_obj, m_key);
+            realm::notification_token token = list->add_notification_callback(
+                                                          std::make_shared<realm::experimental::collection_callback_wrapper>(
+                                                                  std::move(fn),
+                                                                  false));
+            token.m_realm = *m_realm;
+            token.m_list = list;
+            return token;
+        }
+
         // TODO: emulate a reference to the value.
         T operator[](size_t idx) const {
-            auto list = realm::internal::bridge::list(*m_realm, *m_obj, m_key);
-            using U = typename internal::type_info::type_info<T>::internal_type;
-            if constexpr (internal::type_info::MixedPersistableConcept<T>::value) {
-                return deserialize<T>(realm::internal::bridge::get<U>(list, idx));
-            } else if constexpr (std::is_enum_v<T>) {
-                return static_cast<T>(deserialize<T>(realm::internal::bridge::get<U>(list, idx)));
-            } else {
-                return deserialize(realm::internal::bridge::get<U>(list, idx));
-            }
+            return deserialize_value(realm::internal::bridge::get<internal_type>(collection(), idx));
         }
 
         void pop_back() {
-            internal::bridge::list(*m_realm, *m_obj, m_key).remove(size() - 1);
+            collection().remove(size() - 1);
         }
         void erase(size_t idx) {
-            internal::bridge::list(*m_realm, *m_obj, m_key).remove(idx);
+            collection().remove(idx);
         }
         void clear() {
-            internal::bridge::list(*m_realm, *m_obj, m_key).remove_all();
+            collection().remove_all();
         }
         void push_back(const T& value)
         {
-            auto list = internal::bridge::list(*m_realm, *m_obj, m_key);
-            list.add(serialize(value));
+            collection().add(serialize(value));
         }
         size_t size()
         {
-            return internal::bridge::list(*m_realm, *m_obj, m_key).size();
+            return collection().size();
         }
         size_t find(const T& a) {
             if constexpr (std::is_enum_v<T>) {
-                return internal::bridge::list(*m_realm, *m_obj, m_key).find(static_cast<int64_t>(a));
+                return collection().find(static_cast<int64_t>(a));
             } else {
-                return internal::bridge::list(*m_realm, *m_obj, m_key).find(a);
+                return collection().find(a);
             }
         }
         void set(size_t pos, const T& a) {
-            internal::bridge::list(*m_realm, *m_obj, m_key).set(pos, a);
+            collection().set(pos, a);
+        }
+
+        /**
+         Replaces the contents of the list with `values` in a single write to the Realm.
+         */
+        template <typename Range>
+        void assign(const Range& values) {
+            m_obj->set_list_values(m_key, serialize_range(values));
+        }
+        void assign(std::initializer_list<T> values) {
+            assign<std::initializer_list<T>>(values);
+        }
+
+        // Appends `values` to the end of the list with a single call into the Realm.
+        template <typename Range>
+        void append_range(const Range& values) {
+            insert_range(size(), values);
+        }
+
+        // Inserts `values` before the element at `pos` with a single call into the Realm.
+        template <typename Range>
+        void insert_range(size_t pos, const Range& values) {
+            std::vector<internal::bridge::mixed> mixed_values;
+            for (auto&& value : serialize_range(values)) {
+                mixed_values.emplace_back(value);
+            }
+            collection().insert_range(pos, mixed_values);
+        }
+
+        // Truncates the list to `count` elements, or appends default values until it has `count` elements.
+        void resize(size_t count) {
+            m_obj->resize_list(m_key, count);
+        }
+
+        /// Opens a stream reading the list's elements from `offset` as one payload split into chunks.
+        template <typename U = T, std::enable_if_t<std::is_same_v<U, std::vector<uint8_t>>, int> = 0>
+        [[nodiscard]] blob_reader open_read(size_t offset = 0) const {
+            return blob_reader(collection(), offset);
+        }
+
+        /// Opens a stream replacing the list's elements with a payload split into chunks of
+        /// `chunk_size` bytes. Use this for binary payloads larger than a single value can hold.
+        template <typename U = T, std::enable_if_t<std::is_same_v<U, std::vector<uint8_t>>, int> = 0>
+        [[nodiscard]] blob_writer open_write(size_t chunk_size = blob_writer::default_chunk_size) {
+            return blob_writer(collection(), chunk_size);
+        }
+
+    private:
+        template <typename Range>
+        std::vector<internal_type> serialize_range(const Range& values) const {
+            std::vector<internal_type> ret;
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                          typename std::iterator_traits<decltype(std::begin(values))>::iterator_category>) {
+                ret.reserve(std::distance(std::begin(values), std::end(values)));
+            }
+            for (auto&& value : values) {
+                ret.push_back(serialize(static_cast<const T&>(value)));
+            }
+            return ret;
+        }
+
+        T deserialize_value(const internal_type& value) const {
+            if constexpr (internal::type_info::MixedPersistableConcept<T>::value) {
+                return deserialize<T>(value);
+            } else if constexpr (std::is_enum_v<T>) {
+                return static_cast<T>(deserialize<T>(value));
+            } else {
+                return deserialize(value);
+            }
         }
     };
 
     template<typename T>
-    struct managed<std::vector<T*>> : managed_base {
+    struct managed<std::vector<T*>> : managed_list_base {
+        void assign(internal::bridge::obj *obj,
+                    internal::bridge::realm* realm,
+                    const internal::bridge::col_key &key) {
+            m_column_plan.reset();
+            managed_list_base::assign(obj, realm, key);
+        }
+
         [[nodiscard]] std::vector<T*> detach() const {
-            auto list = realm::internal::bridge::list(*m_realm, *m_obj, m_key);
+            auto& list = collection();
             size_t count = list.size();
             if (count == 0)
                 return std::vector<T*>();
             auto ret = std::vector<T*>();
             ret.reserve(count);
+            // Each accessor is bound with the column keys resolved once for the list. A fresh
+            // accessor is needed per object, as properties cache the collections and links they read.
+            auto& plan = column_plan();
+            auto zipped = zipTuples(managed<T>::schema.ps, managed<T>::managed_pointers());
             for(size_t i = 0; i < count; i++) {
-                managed<T> m(realm::internal::bridge::get<internal::bridge::obj>(list, i), *m_realm);
+                managed<T> m(realm::internal::bridge::get<internal::bridge::obj>(list, i), *m_realm, plan);
                 T* v = new T();
                 auto assign = [&m, &v](auto& pair) {
                     (*v).*(std::decay_t<decltype(pair.first)>::ptr) = (m.*(pair.second)).detach();
                 };
-                auto zipped = zipTuples(managed<T>::schema.ps, managed<T>::managed_pointers());
-                std::apply([&v, &m, &assign](auto && ...pair) {
+                std::apply([&assign](auto && ...pair) {
                     (assign(pair), ...);
                 }, zipped);
 
@@ -164,6 +325,29 @@ namespace realm::experimental {
             return ret;
         }
 
+        /**
+         Reads the given properties of every object in the list in a single pass, e.g.
+         `list.prefetch(&Person::name, &Person::age)` returns a `std::vector<std::tuple<std::string, int64_t>>`
+         with one tuple per element, in list order. Only the requested columns are read.
+         Throws `std::invalid_argument` if a field is not a property of the schema.
+         */
+        template <typename... Fields>
+        [[nodiscard]] std::vector<std::tuple<Fields...>> prefetch(Fields T::*... fields) const {
+            auto& list = collection();
+            size_t count = list.size();
+            std::vector<std::tuple<Fields...>> ret;
+            if (count == 0)
+                return ret;
+            ret.reserve(count);
+            auto& plan = column_plan();
+            const std::array<internal::bridge::col_key, sizeof...(Fields)> columns{plan[property_index(fields)]...};
+            for (size_t i = 0; i < count; i++) {
+                auto obj = realm::internal::bridge::get<internal::bridge::obj>(list, i);
+                ret.push_back(read_columns<Fields...>(obj, columns, std::index_sequence_for<Fields...>{}));
+            }
+            return ret;
+        }
+
         class iterator {
         public:
             using value_type = managed<T>;
@@ -185,14 +369,8 @@ namespace realm::experimental {
 
             managed<T> operator*() const noexcept
             {
-                auto list = realm::internal::bridge::list(*m_parent->m_realm, *m_parent->m_obj, m_parent->m_key);
-                managed<T> m(realm::internal::bridge::get<realm::internal::bridge::obj>(list, m_i), *m_parent->m_realm);
-                std::apply([&m](auto &&...ptr) {
-                    std::apply([&](auto &&...name) {
-                        ((m.*ptr).assign(&m.m_obj, &m.m_realm, m.m_obj.get_table().get_column_key(name)), ...);
-                    }, managed<T>::managed_pointers_names);
-                }, managed<T>::managed_pointers());
-                return {std::move(m)};
+                return managed<T>(realm::internal::bridge::get<realm::internal::bridge::obj>(m_parent->collection(), m_i),
+                                  *m_parent->m_realm, m_parent->column_plan());
             }
 
             iterator& operator++()
@@ -229,41 +407,27 @@ namespace realm::experimental {
         }
 
         void pop_back() {
-            internal::bridge::list(*m_realm, *m_obj, m_key).remove(size() - 1);
+            collection().remove(size() - 1);
         }
         void erase(size_t idx) {
-            internal::bridge::list(*m_realm, *m_obj, m_key).remove(idx);
+            collection().remove(idx);
         }
         void clear() {
-            internal::bridge::list(*m_realm, *m_obj, m_key).remove_all();
+            collection().remove_all();
         }
         void push_back(T* value)
         {
-            auto list = internal::bridge::list(*m_realm, *m_obj, m_key);
-            auto table = m_obj->get_target_table(m_key);
-            internal::bridge::obj m_obj;
-            if constexpr (managed<T>::schema.HasPrimaryKeyProperty) {
-                auto pk = (*value).*(managed<T>::schema.primary_key().ptr);
-                m_obj = table.create_object_with_primary_key(realm::internal::bridge::mixed(serialize(pk.value)));
-            } else if (managed<T>::schema.is_embedded_experimental()) {
-                m_obj = list.add_embedded();
+            if (managed<T>::schema.is_embedded_experimental()) {
+                auto obj = collection().add_embedded();
+                set_properties(obj, value);
             } else {
-                m_obj = table.create_object();
-            }
-            std::apply([&m_obj, &value, realm = *m_realm](auto && ...p) {
-                (accessor<typename std::decay_t<decltype(p)>::Result>::set(
-                         m_obj, m_obj.get_table().get_column_key(p.name), realm,
-                         (*value).*(std::decay_t<decltype(p)>::ptr)), ...);
-            }, managed<T, void>::schema.ps);
-            if (!managed<T>::schema.is_embedded_experimental()) {
-                list.add(m_obj.get_key());
+                collection().add(create_object(value));
             }
         }
         void push_back(const managed<T>& value)
         {
-            auto list = internal::bridge::list(*m_realm, *m_obj, m_key);
             if (!managed<T>::schema.is_embedded_experimental()) {
-                list.add(value.m_obj.get_key());
+                collection().add(value.m_obj.get_key());
             } else {
                 throw std::logic_error("Cannot add existing embedded object to managed list.");
             }
@@ -271,8 +435,7 @@ namespace realm::experimental {
         void push_back(const managed<T*>& value)
         {
             if (!managed<T>::schema.is_embedded_experimental()) {
-                auto list = internal::bridge::list(*m_realm, *m_obj, m_key);
-                list.add(value.m_obj->get_key());
+                collection().add(value.m_obj->get_key());
             } else {
                 throw std::logic_error("Cannot add existing embedded object to managed list.");
             }
@@ -280,23 +443,64 @@ namespace realm::experimental {
 
         size_t size() const
         {
-            return internal::bridge::list(*m_realm, *m_obj, m_key).size();
+            return collection().size();
         }
         size_t find(const managed<T>& a) {
-            return internal::bridge::list(*m_realm, *m_obj, m_key).find(a.m_obj.get_key());
+            return collection().find(a.m_obj.get_key());
         }
         size_t find(const typename managed<T*>::ref_type& a) const {
-            return internal::bridge::list(*m_realm, *m_obj, m_key).find(a->m_obj.get_key());
+            return collection().find(a->m_obj.get_key());
         }
+        /**
+         Replaces the contents of the list with `values`, which may be unmanaged objects
+         (`T*`) or objects which are already managed by this Realm. Unmanaged objects are
+         added to the Realm first. For lists of objects which are not embedded the links
+         are written in a single call into the Realm.
+         */
+        template <typename Range>
+        void assign(const Range& values) {
+            if (managed<T>::schema.is_embedded_experimental()) {
+                clear();
+                for (auto&& value : values) {
+                    push_back(value);
+                }
+                return;
+            }
+            m_obj->set_list_values(m_key, keys_for(values));
+        }
+
+        // Appends `values` to the end of the list, see `assign`.
+        template <typename Range>
+        void append_range(const Range& values) {
+            if (managed<T>::schema.is_embedded_experimental()) {
+                for (auto&& value : values) {
+                    push_back(value);
+                }
+                return;
+            }
+            collection().insert_range(size(), keys_for(values));
+        }
+
+        // Inserts `values` before the element at `pos`, see `assign`.
+        template <typename Range>
+        void insert_range(size_t pos, const Range& values) {
+            if (managed<T>::schema.is_embedded_experimental()) {
+                throw std::logic_error("Cannot insert a range into a list of embedded objects, use append_range.");
+            }
+            collection().insert_range(pos, keys_for(values));
+        }
+
+        // Truncates the list to `count` elements. Lists of links can not be grown with default values.
+        void resize(size_t count) {
+            if (count > size()) {
+                throw std::logic_error("Cannot grow a list of objects with resize.");
+            }
+            m_obj->resize_list(m_key, count);
+        }
+
         typename managed<T*>::ref_type operator[](size_t idx) const {
-            auto list = realm::internal::bridge::list(*m_realm, *m_obj, m_key);
-            managed<T> m(realm::internal::bridge::get<realm::internal::bridge::obj>(list, idx), *m_realm);
-            std::apply([&m](auto &&...ptr) {
-                std::apply([&](auto &&...name) {
-                    ((m.*ptr).assign(&m.m_obj, &m.m_realm, m.m_obj.get_table().get_column_key(name)), ...);
-                }, managed<T>::managed_pointers_names);
-            }, managed<T>::managed_pointers());
-            return {std::move(m)};
+            return {managed<T>(realm::internal::bridge::get<realm::internal::bridge::obj>(collection(), idx),
+                               *m_realm, column_plan())};
         }
 
         realm::notification_token observe(std::function<void(realm::experimental::collection_change)>&& fn) {
@@ -309,6 +513,112 @@ namespace realm::experimental {
             token.m_list = list;
             return token;
         }
+
+        // Observe this list with change sets given as index ranges, see `collection_range_change`.
+        realm::notification_token observe_ranges(std::function<void(realm::experimental::collection_range_change)>&& fn) {
+            auto list = std::make_shared<realm::internal::bridge::list>(*m_realm, *m_obj, m_key);
+            realm::notification_token token = list->add_notification_callback(
+                    std::make_shared<realm::experimental::collection_callback_wrapper>(
+                            std::move(fn),
+                            false));
+            token.m_realm = *m_realm;
+            token.m_list = list;
+            return token;
+        }
+
+    private:
+        // The column keys of the target table, resolved once and shared by every element accessor.
+        const std::vector<internal::bridge::col_key>& column_plan() const {
+            if (!m_column_plan) {
+                m_column_plan = managed<T>::column_plan(collection().get_table());
+            }
+            return *m_column_plan;
+        }
+
+        // The position of `field` in the schema, which is also its position in the column plan.
+        template <typename Field>
+        static size_t property_index(Field T::* field) {
+            static_assert(std::apply([](auto&& ...p) {
+                return (std::is_same_v<std::decay_t<decltype(std::decay_t<decltype(p)>::ptr)>, Field T::*> || ...);
+            }, managed<T>::schema.ps), "No property of the schema has the type of this field.");
+            std::optional<size_t> found;
+            size_t index = 0;
+            std::apply([&](auto&& ...p) {
+                ([&](auto& property) {
+                    if constexpr (std::is_same_v<std::decay_t<decltype(std::decay_t<decltype(property)>::ptr)>, Field T::*>) {
+                        if (!found && std::decay_t<decltype(property)>::ptr == field) {
+                            found = index;
+                        }
+                    }
+                    index++;
+                }(p), ...);
+            }, managed<T>::schema.ps);
+            if (!found) {
+                throw std::invalid_argument("The field is not a property of the schema.");
+            }
+            return *found;
+        }
+
+        // Reads a single column of `obj` through a property accessor bound to it.
+        template <typename Field>
+        Field read_column(internal::bridge::obj& obj, const internal::bridge::col_key& column) const {
+            managed<Field> property;
+            property.assign(&obj, m_realm, column);
+            return property.detach();
+        }
+
+        template <typename... Fields, size_t... Is>
+        std::tuple<Fields...> read_columns(internal::bridge::obj& obj,
+                                           const std::array<internal::bridge::col_key, sizeof...(Fields)>& columns,
+                                           std::index_sequence<Is...>) const {
+            return {read_column<Fields>(obj, columns[Is])...};
+        }
+
+        mutable std::optional<std::vector<internal::bridge::col_key>> m_column_plan;
+
+        void set_properties(internal::bridge::obj& obj, T* value) {
+            std::apply([&obj, &value, realm = *m_realm](auto && ...p) {
+                (accessor<typename std::decay_t<decltype(p)>::Result>::set(
+                         obj, obj.get_table().get_column_key(p.name), realm,
+                         (*value).*(std::decay_t<decltype(p)>::ptr)), ...);
+            }, managed<T, void>::schema.ps);
+        }
+
+        // Adds an unmanaged top-level object to the Realm and returns its key.
+        internal::bridge::obj_key create_object(T* value) {
+            auto table = m_obj->get_target_table(m_key);
+            internal::bridge::obj obj;
+            if constexpr (managed<T>::schema.HasPrimaryKeyProperty) {
+                auto pk = (*value).*(managed<T>::schema.primary_key().ptr);
+                obj = table.create_object_with_primary_key(realm::internal::bridge::mixed(serialize(pk.value)));
+            } else {
+                obj = table.create_object();
+            }
+            set_properties(obj, value);
+            return obj.get_key();
+        }
+
+        internal::bridge::obj_key key_for(T* value) {
+            return create_object(value);
+        }
+        internal::bridge::obj_key key_for(const managed<T>& value) {
+            return value.m_obj.get_key();
+        }
+        internal::bridge::obj_key key_for(const managed<T*>& value) {
+            return value.m_obj->get_key();
+        }
+        internal::bridge::obj_key key_for(const typename managed<T*>::ref_type& value) {
+            return value->m_obj.get_key();
+        }
+
+        template <typename Range>
+        std::vector<internal::bridge::obj_key> keys_for(const Range& values) {
+            std::vector<internal::bridge::obj_key> keys;
+            for (auto&& value : values) {
+                keys.push_back(key_for(value));
+            }
+            return keys;
+        }
     };
 } // namespace realm::experimental
 
@@ -86,6 +86,18 @@ namespace realm::experimental {
             return serialize(detach()) <= rhs;
         }
 
+        /// Matches objects whose value is any of `values`, a range of integers.
+        template<typename Range>
+        rbool in(const Range& values) const {
+            if (this->should_detect_usage_for_queries) {
+                return rbool(query_for_any_of(values, [](const auto& v) { return internal::bridge::mixed(static_cast<int64_t>(v)); }));
+            }
+            return is_any_of(values, detach());
+        }
+        rbool in(std::initializer_list<int64_t> values) const {
+            return in<std::initializer_list<int64_t>>(values);
+        }
+
         managed& operator+=(const int64_t& o) {
             auto old_val = m_obj->template get<int64_t>(m_key);
             m_obj->template set<int64_t>(this->m_key, old_val + o);
@@ -421,6 +433,18 @@ CPP_REALM_MANAGED_OPTIONAL_NUMERIC(double);
             }
             return detach() <= rhs;
         }
+
+        /// Matches objects whose value is any of `values`, a range of enumerators.
+        template<typename Range>
+        rbool in(const Range& values) const {
+            if (this->should_detect_usage_for_queries) {
+                return rbool(query_for_any_of(values, [](const T& v) { return internal::bridge::mixed(static_cast<int64_t>(v)); }));
+            }
+            return is_any_of(values, detach());
+        }
+        rbool in(std::initializer_list<T> values) const {
+            return in<std::initializer_list<T>>(values);
+        }
     };
 
     template <typename T>
@@ -29,6 +29,17 @@ namespace realm::experimental {
         //MARK: -   comparison operators
         rbool operator==(const realm::object_id& rhs) const noexcept;
         rbool operator!=(const realm::object_id& rhs) const noexcept;
+        /// Matches objects whose value is any of `values`.
+        template<typename Range>
+        rbool in(const Range& values) const {
+            if (this->should_detect_usage_for_queries) {
+                return rbool(query_for_any_of(values, [](const realm::object_id& v) { return internal::bridge::mixed(serialize(v)); }));
+            }
+            return is_any_of(values, detach());
+        }
+        rbool in(std::initializer_list<realm::object_id> values) const {
+            return in<std::initializer_list<realm::object_id>>(values);
+        }
     };
 
     template<>
@@ -185,6 +185,17 @@ namespace realm::experimental {
             rbool operator>=(const int& rhs) const noexcept;
             rbool operator<(const int& rhs) const noexcept;
             rbool operator<=(const int& rhs) const noexcept;
+            /// Matches objects whose primary key is any of `values`, a range of integers.
+            template<typename Range>
+            rbool in(const Range& values) const {
+                if (this->should_detect_usage_for_queries) {
+                    return rbool(query_for_any_of(values, [](const auto& v) { return internal::bridge::mixed(static_cast<int64_t>(v)); }));
+                }
+                return is_any_of(values, operator int64_t());
+            }
+            rbool in(std::initializer_list<int64_t> values) const {
+                return in<std::initializer_list<int64_t>>(values);
+            }
         };
 
         template<>
@@ -201,6 +212,17 @@ namespace realm::experimental {
             rbool operator!=(const std::string& rhs) const noexcept;
             rbool operator==(const char* rhs) const noexcept;
             rbool operator!=(const char* rhs) const noexcept;
+            /// Matches objects whose primary key is any of `values`, a range of strings.
+            template<typename Range>
+            rbool in(const Range& values) const {
+                if (this->should_detect_usage_for_queries) {
+                    return rbool(query_for_any_of(values, [](const std::string& v) { return internal::bridge::mixed(v); }));
+                }
+                return is_any_of(values, operator std::string());
+            }
+            rbool in(std::initializer_list<std::string> values) const {
+                return in<std::initializer_list<std::string>>(values);
+            }
         };
 
         template<>
@@ -215,6 +237,17 @@ namespace realm::experimental {
 
             rbool operator==(const realm::uuid& rhs) const noexcept;
             rbool operator!=(const realm::uuid& rhs) const noexcept;
+            /// Matches objects whose primary key is any of `values`.
+            template<typename Range>
+            rbool in(const Range& values) const {
+                if (this->should_detect_usage_for_queries) {
+                    return rbool(query_for_any_of(values, [](const realm::uuid& v) { return internal::bridge::mixed(internal::bridge::uuid(v)); }));
+                }
+                return is_any_of(values, operator realm::uuid());
+            }
+            rbool in(std::initializer_list<realm::uuid> values) const {
+                return in<std::initializer_list<realm::uuid>>(values);
+            }
         };
 
         template<>
@@ -229,6 +262,17 @@ namespace realm::experimental {
 
             rbool operator==(const realm::object_id& rhs) const noexcept;
             rbool operator!=(const realm::object_id& rhs) const noexcept;
+            /// Matches objects whose primary key is any of `values`.
+            template<typename Range>
+            rbool in(const Range& values) const {
+                if (this->should_detect_usage_for_queries) {
+                    return rbool(query_for_any_of(values, [](const realm::object_id& v) { return internal::bridge::mixed(internal::bridge::object_id(v)); }));
+                }
+                return is_any_of(values, operator realm::object_id());
+            }
+            rbool in(std::initializer_list<realm::object_id> values) const {
+                return in<std::initializer_list<realm::object_id>>(values);
+            }
         };
 
         template<typename T>
@@ -2,6 +2,7 @@
 #define CPPREALM_MANAGED_SET_HPP
 
 #include <cpprealm/notifications.hpp>
+#include <cpprealm/experimental/collection_query.hpp>
 #include <cpprealm/experimental/macros.hpp>
 #include <cpprealm/experimental/types.hpp>
 #include <cpprealm/experimental/observation.hpp>
@@ -11,10 +12,17 @@
 namespace realm::experimental {
 
     template<typename T>
-    struct managed<std::set<T>, std::enable_if_t<internal::type_info::is_primitive<T>::value>> : managed_base {
+    struct managed<std::set<T>, std::enable_if_t<internal::type_info::is_primitive<T>::value>>
+        : managed_collection_base<internal::bridge::set>, collection_query_operators<managed<std::set<T>>, T> {
         using managed<std::set<T>>::managed_base::operator=;
         using value_type = T;
 
+        /**
+         An iterator over the values of the set in the order of the Realm. Values are fetched
+         through the bridge in batches of `block_size` elements, which are shared between
+         copies of the iterator. The Realm still reads the values of a batch one at a time.
+         Iterators are invalidated by writes to the set.
+         */
         class iterator {
         public:
             using value_type = T;
@@ -24,6 +32,8 @@ namespace realm::experimental {
             using reference = T&;
             using iterator_category = std::forward_iterator_tag;
 
+            static constexpr size_t block_size = 1024;
+
             bool operator!=(const iterator& other) const
             {
                 return !(*this == other);
@@ -34,10 +44,18 @@ namespace realm::experimental {
                 return (m_parent == other.m_parent) && (m_i == other.m_i);
             }
 
-            T operator*() const noexcept
+            T operator*() const
             {
-                auto s = realm::internal::bridge::set(*m_parent->m_realm, *m_parent->m_obj, m_parent->m_key);
-                return deserialize<T>(s.get_any(m_i));
+                if (!m_block) {
+                    m_block = std::make_shared<block>();
+                }
+                if (m_i < m_block->begin || m_i >= m_block->begin + m_block->values.size()) {
+                    m_block->begin = m_i - m_i % block_size;
+                    auto& set = m_parent->collection();
+                    set.get_any_range(m_block->begin, std::min(m_block->begin + block_size, set.size()),
+                                      m_block->values);
+                }
+                return deserialize<T>(m_block->values[m_i - m_block->begin]);
             }
 
             iterator& operator++()
@@ -55,12 +73,18 @@ namespace realm::experimental {
             template<typename, typename>
             friend struct managed;
 
+            struct block {
+                size_t begin = 0;
+                std::vector<internal::bridge::mixed> values;
+            };
+
             iterator(size_t i, managed<std::set<T>>* parent)
                 : m_i(i), m_parent(parent)
             {
             }
             size_t m_i;
             managed<std::set<T>>* m_parent;
+            mutable std::shared_ptr<block> m_block;
         };
         iterator begin()
         {
@@ -72,14 +96,46 @@ namespace realm::experimental {
             return iterator(size(), this);
         }
         [[nodiscard]] std::set<T> detach() const {
-            auto set = realm::internal::bridge::set(*m_realm, *m_obj, m_key);
+            auto& set = collection();
+            std::vector<internal::bridge::mixed> values;
+            set.get_any_range(0, set.size(), values);
             auto ret = std::set<T>();
-            for(size_t i = 0; i < set.size(); i++) {
-                ret.insert(deserialize<T>(set.get_any(i)));
+            for (auto& value : values) {
+                // Values are mostly in order already, which makes the hint effective.
+                ret.insert(ret.end(), deserialize<T>(value));
             }
             return ret;
         }
 
+        // Adds the elements of `other` to this set.
+        void merge(const managed<std::set<T>>& other) {
+            collection().assign_union(other.collection());
+        }
+        // Removes the elements which are not in `other` from this set.
+        void intersect(const managed<std::set<T>>& other) {
+            collection().assign_intersection(other.collection());
+        }
+        // Removes the elements of `other` from this set.
+        void subtract(const managed<std::set<T>>& other) {
+            collection().assign_difference(other.collection());
+        }
+        // Keeps the elements which are in exactly one of the two sets.
+        void symmetric_difference(const managed<std::set<T>>& other) {
+            collection().assign_symmetric_difference(other.collection());
+        }
+        [[nodiscard]] bool is_subset_of(const managed<std::set<T>>& other) const {
+            return collection().is_subset_of(other.collection());
+        }
+        [[nodiscard]] bool is_superset_of(const managed<std::set<T>>& other) const {
+            return collection().is_superset_of(other.collection());
+        }
+        [[nodiscard]] bool intersects(const managed<std::set<T>>& other) const {
+            return collection().intersects(other.collection());
+        }
+        [[nodiscard]] bool set_equals(const managed<std::set<T>>& other) const {
+            return collection().set_equals(other.collection());
+        }
+
         realm::notification_token observe(std::function<void(realm::experimental::collection_change)>&& fn) {
             auto set = std::make_shared<realm::internal::bridge::set>(*m_realm, *m_obj, m_key);
             realm::notification_token token = set->add_notification_callback(
@@ -91,15 +147,27 @@ namespace realm::experimental {
             return token;
         }
 
+        // Observe this set with change sets given as index ranges, see `collection_range_change`.
+        realm::notification_token observe_ranges(std::function<void(realm::experimental::collection_range_change)>&& fn) {
+            auto set = std::make_shared<realm::internal::bridge::set>(*m_realm, *m_obj, m_key);
+            realm::notification_token token = set->add_notification_callback(
+                    std::make_shared<realm::experimental::collection_callback_wrapper>(
+                            std::move(fn),
+                            false));
+            token.m_realm = *m_realm;
+            token.m_set = set;
+            return token;
+        }
+
         void erase(const iterator& it)
         {
-            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            auto& set = collection();
             set.remove(serialize(*it));
         }
 
         std::pair<iterator, bool> insert(const T& v)
         {
-            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            auto& set = collection();
             if constexpr (internal::type_info::MixedPersistableConcept<T>::value) {
                 std::pair<size_t, bool> res = set.insert(serialize<T>(v));
                 return std::pair<iterator, bool>(iterator(res.first, this), res.second);
@@ -111,31 +179,31 @@ namespace realm::experimental {
 
         iterator insert(const iterator& i, const T& v)
         {
-            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            auto& set = collection();
             std::pair<size_t, bool> res = set.insert(v);
             return iterator(res.first, this);
         }
 
         iterator find(const T& v)
         {
-            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            auto& set = collection();
             size_t idx = set.find(serialize(v));
             if (idx == realm::npos)
                 return iterator(size(), this);
             return iterator(idx, this);
         }
         void clear() {
-            internal::bridge::set(*m_realm, *m_obj, m_key).remove_all();
+            collection().remove_all();
         }
 
         size_t size()
         {
-            return internal::bridge::set(*m_realm, *m_obj, m_key).size();
+            return collection().size();
         }
     };
 
     template<typename T>
-    struct managed<std::set<T*>> : managed_base {
+    struct managed<std::set<T*>> : managed_collection_base<internal::bridge::set> {
         using managed<std::set<T*>>::managed_base::operator=;
         using value_type = managed<T>;
 
@@ -160,8 +228,7 @@ namespace realm::experimental {
 
             managed<T> operator*() const noexcept
             {
-                auto s = realm::internal::bridge::set(*m_parent->m_realm, *m_parent->m_obj, m_parent->m_key);
-                managed<T> m(s.get_obj(m_i), *m_parent->m_realm);
+                managed<T> m(m_parent->collection().get_obj(m_i), *m_parent->m_realm);
                 std::apply([&m](auto &&...ptr) {
                     std::apply([&](auto &&...name) {
                         ((m.*ptr).assign(&m.m_obj, &m.m_realm, m.m_obj.get_table().get_column_key(name)), ...);
@@ -202,7 +269,7 @@ namespace realm::experimental {
             return iterator(size(), this);
         }
         [[nodiscard]] std::set<T*> detach() const {
-            auto s = realm::internal::bridge::set(*m_realm, *m_obj, m_key);
+            auto& s = collection();
             size_t count = s.size();
             if (count == 0)
                 return std::set<T*>();
@@ -223,6 +290,32 @@ namespace realm::experimental {
             return ret;
         }
 
+        // Set algebra evaluated by the Realm, see the primitive set for details.
+        void merge(const managed<std::set<T*>>& other) {
+            collection().assign_union(other.collection());
+        }
+        void intersect(const managed<std::set<T*>>& other) {
+            collection().assign_intersection(other.collection());
+        }
+        void subtract(const managed<std::set<T*>>& other) {
+            collection().assign_difference(other.collection());
+        }
+        void symmetric_difference(const managed<std::set<T*>>& other) {
+            collection().assign_symmetric_difference(other.collection());
+        }
+        [[nodiscard]] bool is_subset_of(const managed<std::set<T*>>& other) const {
+            return collection().is_subset_of(other.collection());
+        }
+        [[nodiscard]] bool is_superset_of(const managed<std::set<T*>>& other) const {
+            return collection().is_superset_of(other.collection());
+        }
+        [[nodiscard]] bool intersects(const managed<std::set<T*>>& other) const {
+            return collection().intersects(other.collection());
+        }
+        [[nodiscard]] bool set_equals(const managed<std::set<T*>>& other) const {
+            return collection().set_equals(other.collection());
+        }
+
         realm::notification_token observe(std::function<void(realm::experimental::collection_change)>&& fn) {
             auto set = std::make_shared<realm::internal::bridge::set>(*m_realm, *m_obj, m_key);
             realm::notification_token token = set->add_notification_callback(
@@ -234,15 +327,27 @@ namespace realm::experimental {
             return token;
         }
 
+        // Observe this set with change sets given as index ranges, see `collection_range_change`.
+        realm::notification_token observe_ranges(std::function<void(realm::experimental::collection_range_change)>&& fn) {
+            auto set = std::make_shared<realm::internal::bridge::set>(*m_realm, *m_obj, m_key);
+            realm::notification_token token = set->add_notification_callback(
+                    std::make_shared<realm::experimental::collection_callback_wrapper>(
+                            std::move(fn),
+                            false));
+            token.m_realm = *m_realm;
+            token.m_set = set;
+            return token;
+        }
+
         void erase(const iterator& it)
         {
-            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            auto& set = collection();
             set.remove(it.operator*().m_obj.get_key());
         }
 
         std::pair<iterator, bool> insert(T* value)
         {
-            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            auto& set = collection();
             auto table = m_obj->get_target_table(m_key);
             internal::bridge::obj m_obj;
             if constexpr (managed<T>::schema.HasPrimaryKeyProperty) {
@@ -265,7 +370,7 @@ namespace realm::experimental {
 
         iterator insert(const iterator& i, T* value)
         {
-            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            auto& set = collection();
             auto table = m_obj->get_target_table(m_key);
             internal::bridge::obj m_obj;
             if constexpr (managed<T>::schema.HasPrimaryKeyProperty) {
@@ -285,7 +390,7 @@ namespace realm::experimental {
 
         std::pair<iterator, bool> insert(const managed<T>& value)
         {
-            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            auto& set = collection();
             std::pair<size_t, bool> res = set.insert(value.m_obj.get_key());
             return std::pair<iterator, bool>(iterator(res.first, this), res.second);
 
@@ -293,14 +398,14 @@ namespace realm::experimental {
 
         iterator insert(const iterator& i, const managed<T>& value)
         {
-            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            auto& set = collection();
             std::pair<size_t, bool> res = set.insert(value.m_obj.get_key());
             return iterator(res.first, this);
         }
 
         std::pair<iterator, bool> insert(const managed<T*>& value)
         {
-            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            auto& set = collection();
             std::pair<size_t, bool> res = set.insert(value.m_obj.get_key());
             return std::pair<iterator, bool>(iterator(res.first, this), res.second);
 
@@ -308,14 +413,14 @@ namespace realm::experimental {
 
         iterator insert(const iterator& i, const managed<T*>& value)
         {
-            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            auto& set = collection();
             std::pair<size_t, bool> res = set.insert(value.m_obj.get_key());
             return iterator(res.first, this);
         }
 
         iterator find(const managed<T>& v)
         {
-            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            auto& set = collection();
             size_t idx = set.find(v.m_obj.get_key());
             if (idx == realm::npos)
                 return iterator(size(), this);
@@ -324,19 +429,19 @@ namespace realm::experimental {
 
         iterator find(const managed<T*>& v)
         {
-            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            auto& set = collection();
             size_t idx = set.find(v.m_obj->get_key());
             if (idx == realm::npos)
                 return iterator(size(), this);
             return iterator(idx, this);
         }
         void clear() {
-            internal::bridge::set(*m_realm, *m_obj, m_key).remove_all();
+            collection().remove_all();
         }
 
         size_t size()
         {
-            return internal::bridge::set(*m_realm, *m_obj, m_key).size();
+            return collection().size();
         }
     };
 } // namespace realm::experimental
@@ -24,6 +24,25 @@ namespace realm::experimental {
         return m_parent->get()[m_idx];
     }
 
+    //MARK: - string edit
+    string_edit::string_edit(managed<std::string> *parent)
+        : m_parent(parent), m_buffer(parent->get()), m_original(m_buffer) {}
+    string_edit::string_edit(string_edit &&other) noexcept
+        : m_parent(std::exchange(other.m_parent, nullptr))
+        , m_buffer(std::move(other.m_buffer))
+        , m_original(std::move(other.m_original)) {}
+    // Writing to the Realm can throw, so uncommitted changes are discarded instead.
+    string_edit::~string_edit() = default;
+    void string_edit::commit() {
+        if (m_parent && m_buffer != m_original) {
+            m_parent->set(m_buffer);
+            m_original = m_buffer;
+        }
+    }
+    void string_edit::discard() noexcept {
+        m_parent = nullptr;
+    }
+
     //MARK: - char pointer
     char_pointer::char_pointer(managed<std::string> *parent)
     : m_parent(parent) {}
@@ -90,6 +109,10 @@ namespace realm::experimental {
         set(value);
     }
 
+    string_edit managed_string::edit() {
+        return string_edit(this);
+    }
+
     std::string managed_string::detach() const {
         return get();
     }
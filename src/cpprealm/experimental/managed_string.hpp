@@ -45,6 +45,39 @@ namespace realm::experimental {
         const managed<std::string>* m_parent;
     };
 
+    //MARK: - string edit
+    /**
+     Buffers edits to a managed string and writes the result back once.
+
+     Every mutation of a `managed<std::string>` reads and rewrites the whole value, and
+     produces a changeset instruction when the Realm is synchronized. Mutating the buffer
+     of an edit instead combines any number of changes into a single write, performed
+     when `commit()` is called inside the write transaction the edit was opened in. The
+     destructor never writes to the Realm, so changes which have not been committed when
+     the edit goes out of scope are discarded.
+     */
+    struct string_edit {
+        string_edit(const string_edit&) = delete;
+        string_edit& operator=(const string_edit&) = delete;
+        string_edit(string_edit&& other) noexcept;
+        string_edit& operator=(string_edit&&) = delete;
+        ~string_edit();
+
+        std::string& operator*() noexcept { return m_buffer; }
+        std::string* operator->() noexcept { return &m_buffer; }
+
+        /// Writes the buffer back to the Realm, if it has been changed. The edit stays open.
+        void commit();
+        /// Ends the edit without writing back.
+        void discard() noexcept;
+    private:
+        explicit string_edit(managed<std::string>* parent);
+        template <typename, typename> friend struct realm::experimental::managed;
+        managed<std::string>* m_parent;
+        std::string m_buffer;
+        std::string m_original;
+    };
+
     //MARK: - managed string
     template <> struct managed<std::string> : managed_base {
         using managed<std::string>::managed_base::managed_base;
@@ -101,6 +134,8 @@ namespace realm::experimental {
         managed& operator+=(const std::string&);
         /// removes the last character from the string.
         void pop_back();
+        /// begins buffering edits to the string, which are written back once when the edit is committed
+        [[nodiscard]] string_edit edit();
 
         //MARK: -   comparison operators
         rbool operator==(const std::string& rhs) const noexcept;
@@ -109,6 +144,17 @@ namespace realm::experimental {
         rbool operator!=(const char* rhs) const noexcept;
         rbool contains(const std::string &s) const noexcept;
         rbool empty() const noexcept;
+        /// Matches objects whose value is any of `values`, a range of strings.
+        template<typename Range>
+        rbool in(const Range& values) const {
+            if (this->should_detect_usage_for_queries) {
+                return rbool(query_for_any_of(values, [](const std::string& v) { return internal::bridge::mixed(v); }));
+            }
+            return is_any_of(values, get());
+        }
+        rbool in(std::initializer_list<std::string> values) const {
+            return in<std::initializer_list<std::string>>(values);
+        }
 #ifdef __cpp_impl_three_way_comparison
         inline auto operator<=>(const std::string& rhs) const noexcept {
             return get().compare(rhs) <=> 0;
@@ -121,6 +167,7 @@ namespace realm::experimental {
     private:
         friend struct char_reference;
         friend struct const_char_reference;
+        friend struct string_edit;
         void inline set(const std::string& v) { m_obj->template set<std::string>(m_key, v); }
         [[nodiscard]] inline std::string get() const { return m_obj->get<std::string>(m_key); }
     };
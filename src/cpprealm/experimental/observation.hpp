@@ -10,8 +10,14 @@
 #include <cpprealm/internal/bridge/table.hpp>
 #include <cpprealm/internal/bridge/thread_safe_reference.hpp>
 
+#include <cpprealm/scheduler.hpp>
+
 #include <realm/object-store/util/scheduler.hpp>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <iostream>
+#include <optional>
 #include <variant>
 
 namespace realm::experimental {
@@ -63,47 +69,73 @@ namespace realm::experimental {
         std::vector<PropertyChange<T>> property_changes;
     };
 
+    /**
+     Names a property of `T` by its member pointer, e.g. `&Person::name`, to restrict
+     notifications to changes on that property.
+     */
+    template<typename T>
+    struct property_key_path {
+        template<typename V>
+        property_key_path(V T::*ptr) // NOLINT(google-explicit-constructor)
+            : name(managed<T>::schema.name_for_property(ptr)) {}
+
+        std::string_view name;
+
+        static internal::bridge::key_path_array to_key_path_array(const internal::bridge::table& table,
+                                                                  const std::vector<property_key_path>& key_paths) {
+            internal::bridge::key_path_array paths;
+            paths.reserve(key_paths.size());
+            for (auto& key_path : key_paths) {
+                paths.push_back({{table.get_key(), table.get_column_key(key_path.name).value()}});
+            }
+            return paths;
+        }
+    };
+
     template<typename T>
     struct ObjectChangeCallbackWrapper : internal::bridge::collection_change_callback {
+        static constexpr size_t property_count = std::tuple_size<decltype(T::schema.properties)>{};
+
         ObjectChangeCallbackWrapper(std::function<void(object_change < T > )> &&b,
                                     const T *obj,
                                     std::shared_ptr<internal::bridge::object> internal_object)
                 : block(std::move(b)), object(*obj), m_object(internal_object) {
-            static_cast<void>(obj);
+            // Resolve the column of every property once rather than on each change.
+            auto table = m_object->get_obj().get_table();
+            for (size_t i = 0; i < property_count; i++) {
+                m_column_keys[i] = table.get_column_key(T::schema.names[i]).value();
+            }
         }
         std::function<void(object_change < T > )> block;
         const T object;
         std::shared_ptr<internal::bridge::object> m_object;
+        std::array<int64_t, property_count> m_column_keys;
 
-        std::optional<std::vector<std::string>> property_names = std::nullopt;
+        // Indices into `T::schema.names` of the properties which changed.
+        std::optional<std::vector<size_t>> property_indices = std::nullopt;
         std::optional<std::vector<typename decltype(T::schema)::variant_t>> old_values = std::nullopt;
         bool deleted = false;
 
         void populateProperties(internal::bridge::collection_change_set const &c) {
-            if (property_names) {
+            if (property_indices) {
                 return;
             }
             if (!c.deletions().empty()) {
                 deleted = true;
                 return;
             }
-            if (c.columns().empty()) {
-                return;
-            }
 
             // FIXME: It's possible for the column key of a persisted property
             // FIXME: to equal the column key of a computed property.
-            auto properties = std::vector<std::string>();
-            auto table = m_object->get_obj().get_table();
-
-            for (auto i = 0; i < std::tuple_size<decltype(T::schema.properties)>{}; i++) {
-                if (c.columns().count(table.get_column_key(T::schema.names[i]).value())) {
-                    properties.push_back(T::schema.names[i]);
+            auto indices = std::vector<size_t>();
+            for (size_t i = 0; i < property_count; i++) {
+                if (c.is_column_modified(m_column_keys[i])) {
+                    indices.push_back(i);
                 }
             }
 
-            if (!properties.empty()) {
-                property_names = properties;
+            if (!indices.empty()) {
+                property_indices = std::move(indices);
             }
         }
 
@@ -113,14 +145,14 @@ namespace realm::experimental {
                 return std::nullopt;
             }
             populateProperties(c);
-            if (!property_names) {
+            if (!property_indices) {
                 return std::nullopt;
             }
 
             std::vector<typename decltype(T::schema)::variant_t> values;
-            for (auto &name: *property_names) {
-                auto value = T::schema.property_value_for_name(name, object, true);
-                values.push_back(value);
+            values.reserve(property_indices->size());
+            for (auto i: *property_indices) {
+                values.push_back(T::schema.property_value_at(i, object, true));
             }
             return values;
         }
@@ -134,13 +166,18 @@ namespace realm::experimental {
             if (deleted) {
                 forward_change(nullptr, {}, {}, {}, nullptr);
             } else if (new_values) {
+                std::vector<std::string> property_names;
+                property_names.reserve(property_indices->size());
+                for (auto i: *property_indices) {
+                    property_names.emplace_back(T::schema.names[i]);
+                }
                 forward_change(&object,
-                               *property_names,
+                               std::move(property_names),
                                old_values ? *old_values : std::vector<typename decltype(T::schema)::variant_t>{},
                                *new_values,
                                nullptr);
             }
-            property_names = std::nullopt;
+            property_indices = std::nullopt;
             old_values = std::nullopt;
         }
 
@@ -200,8 +237,35 @@ namespace realm::experimental {
         }
     };
 
+    using index_range = internal::bridge::index_range;
+    // An iterable of the `[begin, end)` ranges of a change, see `collection_range_change`.
+    using index_ranges = internal::bridge::index_set::range_view;
+
+    /**
+     A change set which exposes the ranges computed by the Realm directly instead of
+     expanding them into one vector entry per index, so that e.g. deleting a million
+     rows is reported as a single range without allocating.
+
+     The ranges reference the change set owned by the notifier and are only valid
+     for the duration of the handler invocation. Copy them out, e.g. into
+     `std::vector<index_range>`, to keep them around.
+     */
+    struct collection_range_change {
+        index_ranges deletions;
+        index_ranges insertions;
+        index_ranges modifications;
+
+        bool collection_root_was_deleted = false;
+
+        [[nodiscard]] bool empty() const noexcept {
+            return deletions.empty() && insertions.empty() && modifications.empty() &&
+                   !collection_root_was_deleted;
+        }
+    };
+
     struct collection_callback_wrapper : internal::bridge::collection_change_callback {
         std::function<void(collection_change)> handler;
+        std::function<void(collection_range_change)> range_handler;
         bool ignoreChangesInInitialNotification;
 
         collection_callback_wrapper(std::function<void(collection_change)> handler,
@@ -210,9 +274,17 @@ namespace realm::experimental {
               , ignoreChangesInInitialNotification(ignoreChangesInInitialNotification)
         {}
 
+        collection_callback_wrapper(std::function<void(collection_range_change)> handler,
+                                    bool ignoreChangesInInitialNotification)
+            : range_handler(std::move(handler))
+              , ignoreChangesInInitialNotification(ignoreChangesInInitialNotification)
+        {}
 
         void before(const realm::internal::bridge::collection_change_set &c) final {}
         void after(internal::bridge::collection_change_set const& changes) final {
+            if (range_handler) {
+                return after_ranges(changes);
+            }
             if (ignoreChangesInInitialNotification) {
                 ignoreChangesInInitialNotification = false;
                 handler({{},{},{}});
@@ -230,6 +302,20 @@ namespace realm::experimental {
         }
 
     private:
+        void after_ranges(internal::bridge::collection_change_set const& changes) {
+            if (ignoreChangesInInitialNotification) {
+                ignoreChangesInInitialNotification = false;
+                range_handler({});
+            } else if (changes.empty()) {
+                range_handler({});
+            } else if (!changes.collection_root_was_deleted() || !changes.deletion_ranges().empty()) {
+                range_handler({changes.deletion_ranges(),
+                               changes.insertion_ranges(),
+                               changes.modification_ranges(),
+                               changes.collection_root_was_deleted()});
+            }
+        }
+
         std::vector<uint64_t> to_vector(const internal::bridge::index_set& index_set) {
             auto vector = std::vector<uint64_t>();
             for (auto index : index_set.as_indexes()) {
@@ -239,326 +325,172 @@ namespace realm::experimental {
         };
     };
 
-#if __cpp_coroutines
-        template<typename T>
-        struct ObjectChangeCallbackWrapper2;
-
-        template <typename T>
-        struct generator {
-            struct promise_type;
-            using handle_type = coro::coroutine_handle<promise_type>;
-
-            struct promise_type // required
-            {
-                T value_;
-                std::exception_ptr exception_;
-
-                generator get_return_object() {
-                    return generator(handle_type::from_promise(*this));
-                }
+    /**
+     A change set which may span several commits, delivered by observers registered
+     with `observe_coalesced`. Indices are given as `[begin, end)` ranges, where
+     deletions refer to the collection before the first commit and insertions and
+     modifications to the collection after the last one.
+     */
+    struct coalesced_change {
+        std::vector<index_range> deletions;
+        std::vector<index_range> insertions;
+        std::vector<index_range> modifications;
 
-                coro::suspend_always initial_suspend() { return {}; }
+        bool collection_root_was_deleted = false;
 
-                coro::suspend_always final_suspend() noexcept {
-                    std::cout << "generator::promise_type::final_suspend\n";
-                    return {};
-                }
+        // The number of commits whose changes were merged into this one.
+        size_t commit_count = 0;
 
-                void unhandled_exception() { exception_ = std::current_exception(); } // saving
-                // exception
+        [[nodiscard]] bool empty() const noexcept {
+            return deletions.empty() && insertions.empty() && modifications.empty() &&
+                   !collection_root_was_deleted;
+        }
+    };
 
-                template <std::convertible_to<T> From>
-                // C++20 concept
-                coro::suspend_always yield_value(From &&from) {
-                    value_ = std::forward<From>(from); // caching the result in promise
-                    return {};
-                }
+    struct coalescing_options {
+        // The minimum time between two deliveries. Changes committed in between are merged.
+        std::chrono::milliseconds min_interval{0};
+        // How long to wait after the first change of a batch for further changes to merge
+        // before delivering it.
+        std::chrono::milliseconds window{0};
+    };
 
-                std::shared_ptr<ObjectChangeCallbackWrapper2<typename T::underlying>> v;
+    struct notification_stats {
+        // Handler invocations, not counting the initial notification.
+        size_t delivered = 0;
+        // Notifications from the Realm which did not cause a handler invocation of their own.
+        size_t suppressed = 0;
+        // Change sets which were merged into a change set that was already pending.
+        size_t merged = 0;
+    };
 
-                void return_value(std::shared_ptr<ObjectChangeCallbackWrapper2<typename T::underlying>> val) {
-                    v = val;
-                }
-            };
+    struct coalescing_callback_wrapper : internal::bridge::collection_change_callback,
+                                         std::enable_shared_from_this<coalescing_callback_wrapper> {
+        coalescing_callback_wrapper(std::function<void(coalesced_change)>&& handler,
+                                    const coalescing_options& options,
+                                    std::shared_ptr<scheduler> scheduler)
+            : m_handler(std::move(handler)), m_options(options), m_scheduler(std::move(scheduler)) {}
 
-            handle_type h_;
+        void before(const internal::bridge::collection_change_set&) final {}
 
-            generator(handle_type h)
-                    : h_(h) {
+        void after(const internal::bridge::collection_change_set& changes) final {
+            if (m_ignore_changes_in_initial_notification) {
+                m_ignore_changes_in_initial_notification = false;
+                m_handler({});
+                return;
             }
-
-            explicit operator bool() {
-                fill();
-                return !h_.done();
+            if (changes.empty() || (changes.collection_root_was_deleted() && changes.deletions().empty())) {
+                m_suppressed++;
+                return;
             }
-
-            T operator()() {
-                fill();
-                full_ = false;
-                return std::move(h_.promise().value_);
+            if (m_pending) {
+                m_pending->merge(changes);
+                m_pending_commits++;
+                m_merged++;
+                m_suppressed++;
+                return;
             }
 
-            bool await_ready() { return false; }
-
-            coro::coroutine_handle<> out_h;
-        private:
-            bool full_ = false;
-
-            void fill() {
-                if (!full_) {
-                    h_();
-                    if (h_.promise().exception_)
-                        std::rethrow_exception(h_.promise().exception_);
-
-                    full_ = true;
-                }
+            m_pending = changes;
+            m_pending_commits = 1;
+            auto now = std::chrono::steady_clock::now();
+            auto due = now + m_options.window;
+            if (m_last_delivery) {
+                due = std::max(due, *m_last_delivery + m_options.min_interval);
             }
-        };
-
-        template<typename T>
-        struct ObjectChangeCallbackWrapper2 : internal::bridge::collection_change_callback,
-                                              std::enable_shared_from_this<ObjectChangeCallbackWrapper2<T>> {
-            using std::enable_shared_from_this<ObjectChangeCallbackWrapper2<T>>::shared_from_this;
-
-            ObjectChangeCallbackWrapper2(const T *obj,
-                                         const internal::bridge::object &internal_object)
-                    : object(obj),
-                      m_object(internal_object.freeze(internal_object.get_realm().freeze())) {}
-
-            internal::bridge::notification_token token;
-            const T *object;
-            internal::bridge::object m_object;
-
-            std::optional<std::vector<std::string>> property_names = std::nullopt;
-            std::optional<std::vector<typename decltype(T::schema)::variant_t>> old_values = std::nullopt;
-            bool deleted = false;
-
-            void populateProperties(internal::bridge::collection_change_set const &c) {
-                if (property_names) {
-                    return;
-                }
-                if (!c.deletions().empty()) {
-                    deleted = true;
-                    return;
-                }
-                if (c.columns().empty()) {
-                    return;
-                }
-
-                auto properties = std::vector<std::string>();
-                auto table = m_object.obj().get_table();
-
-                for (auto i = 0; i < std::tuple_size<decltype(T::schema.properties)>{}; i++) {
-                    if (c.columns().count(table.get_column_key(T::schema.names[i]).value())) {
-                        properties.push_back(T::schema.names[i]);
-                    }
-                }
-
-                if (!properties.empty()) {
-                    property_names = properties;
-                }
+            if (due <= now) {
+                flush();
+                return;
             }
-
-            std::optional<std::vector<typename decltype(T::schema)::variant_t>>
-            readValues(internal::bridge::collection_change_set const &c, bool is_old = false) {
-                if (c.empty()) {
-                    return std::nullopt;
-                }
-                populateProperties(c);
-                if (!property_names) {
-                    return std::nullopt;
+            internal::invoke_after(m_scheduler, due - now, [weak = weak_from_this()] {
+                if (auto self = weak.lock()) {
+                    self->flush();
                 }
+            });
+        }
 
-                std::vector<typename decltype(T::schema)::variant_t> values;
-                for (auto &name: *property_names) {
-                    if (is_old) {
-                        auto value = T(std::move(m_object).obj(), object->m_realm).property_value_for_name(name);
-                        values.push_back(value);
-                    } else {
-                        auto value = object->property_value_for_name(name);
-                        values.push_back(value);
-                    }
-                }
-                if (is_old) {
-                    auto config = object->m_realm.get_config();
-                    config.set_scheduler(realm::util::Scheduler::make_dispatch(dispatch_get_current_queue()));
-                    auto realm = internal::bridge::realm(config);
-                    realm.refresh();
-                    m_object = internal::bridge::object(object->m_realm, object->m_obj).freeze(realm);
-                }
-                return values;
-            }
-
-            void before(internal::bridge::collection_change_set const &c) override {
-                old_values = readValues(c, true);
-            }
-
-            std::mutex m;
-            std::condition_variable cv;
-            bool ready = false;
-            bool processed = false;
-
-            std::optional<std::vector<typename decltype(T::schema)::variant_t>> new_values;
-
-            void after(internal::bridge::collection_change_set const &c) override {
-                new_values = readValues(c);
-                if (!deleted && !new_values) {
-                    return;
-                }
-                processed = true;
-                std::cout << "Worker thread signals data processing completed\n";
-                cv.notify_one();
+        void flush() {
+            if (!m_pending || !m_active) {
+                return;
             }
+            auto changes = std::move(*m_pending);
+            m_pending.reset();
+            m_last_delivery = std::chrono::steady_clock::now();
+            m_delivered++;
+            m_handler({
+                    changes.deletions().as_ranges(),
+                    changes.insertions().as_ranges(),
+                    changes.modifications_new().as_ranges(),
+                    changes.collection_root_was_deleted(),
+                    std::exchange(m_pending_commits, 0)
+            });
+        }
 
-            std::exception_ptr ptr;
+        void deactivate() {
+            m_active = false;
+        }
 
-            void error(const std::exception_ptr &err) {
-                ptr = err;
-            }
+        [[nodiscard]] notification_stats stats() const {
+            return {m_delivered.load(), m_suppressed.load(), m_merged.load()};
+        }
 
-            generator<object_change<T>> forward_change() {
-                while (true) {
-                    std::cout << "FORWARD_CHANGE" << std::endl;
-                    {
-                        std::lock_guard lk(m);
-                        ready = true;
-                        std::cout << "main() signals data ready for processing\n";
-                    }
-                    cv.notify_one();
-                    {
-                        std::unique_lock lk(m); \
-                    cv.wait(lk, [&] { return processed; }); \
+    private:
+        std::function<void(coalesced_change)> m_handler;
+        coalescing_options m_options;
+        std::shared_ptr<scheduler> m_scheduler;
+        bool m_ignore_changes_in_initial_notification = true;
+
+        // Only accessed on the Realm's scheduler.
+        std::optional<internal::bridge::collection_change_set> m_pending;
+        size_t m_pending_commits = 0;
+        // Unset until the first change is delivered, which only waits for the window.
+        std::optional<std::chrono::steady_clock::time_point> m_last_delivery;
+
+        std::atomic<bool> m_active = {true};
+        std::atomic<size_t> m_delivered = {0};
+        std::atomic<size_t> m_suppressed = {0};
+        std::atomic<size_t> m_merged = {0};
+    };
 
-                    }
-                    std::cout << "Back in main()\n";
-
-
-                    if (deleted) {
-                        if (ptr) {
-                            std::cout << "yield err\n";
-                            co_yield realm::experimental::object_change<T>({.error = ptr});
-                        } else {
-                            std::cout << "yield deleted\n";
-                            co_yield realm::experimental::object_change<T>({.is_deleted = true});
-                        }
-                    } else if (property_names) {
-                        std::cout << "SIZE" << property_names->size() << std::endl;
-                        for (size_t i = 0; i < property_names->size(); i++) {
-                            realm::experimental::PropertyChange<T> property;
-                            property.name = (*property_names)[i];
-                            if (!old_values->empty()) {
-                                property.old_value = (*old_values)[i];
-                            }
-                            if (!new_values->empty()) {
-                                property.new_value = (*new_values)[i];
-                            }
-                            std::cout << "yield change\n";
-                            co_yield realm::experimental::object_change<T>(
-                                    {.object = object, .property = property});
-                        }
-                    } else {
-                        std::cout << "yield nothing\n";
-                    }
-                    property_names = std::nullopt;
-                    old_values = std::nullopt;
-                    ready = false;
-                    processed = false;
-                }
-                co_return shared_from_this();
+    /**
+     The token returned by `observe_coalesced`. Besides keeping the observation alive it
+     exposes counters for the notifications it coalesced.
+     */
+    struct coalesced_notification_token {
+        coalesced_notification_token() = default;
+        coalesced_notification_token(internal::bridge::notification_token&& token,
+                                     std::shared_ptr<coalescing_callback_wrapper> wrapper)
+            : m_token(std::move(token)), m_wrapper(std::move(wrapper)) {}
+        coalesced_notification_token(const coalesced_notification_token&) = delete;
+        coalesced_notification_token& operator=(const coalesced_notification_token&) = delete;
+        coalesced_notification_token(coalesced_notification_token&&) = default;
+        coalesced_notification_token& operator=(coalesced_notification_token&& other) {
+            if (this != &other) {
+                unregister();
+                m_token = std::move(other.m_token);
+                m_wrapper = std::move(other.m_wrapper);
             }
-        };
-
-        auto switch_to_new_thread(std::thread &out) {
-            struct awaitable {
-                std::thread *p_out;
-
-                bool await_ready() { return false; }
-
-                void await_suspend(coro::coroutine_handle<> h) {
-                    std::thread &out = *p_out;
-                    if (out.joinable())
-                        throw std::runtime_error("Output jthread parameter not empty");
-                    out = std::thread([h]() mutable { h.resume(); });
-                    // Potential undefined behavior: accessing potentially destroyed *this
-                    // std::cout << "New thread ID: " << p_out->get_id() << '\n';
-                    std::cout << "New thread ID: " << out.get_id() << '\n'; // this is OK
-                }
-
-                void await_resume() {}
-            };
-            return awaitable{&out};
+            return *this;
         }
-
-        template<typename T>
-        auto switch_to_new_queue(dispatch_queue_t &out) {
-            struct awaitable {
-                dispatch_queue_t *p_out;
-
-                bool await_ready() { return false; }
-
-                void await_suspend(coro::coroutine_handle<> h) {
-                    dispatch_queue_t &out = *p_out;
-                    __block auto _h = h;
-                    __block auto loop = CFRunLoopGetCurrent();
-                    dispatch_async(out, ^{
-                        _h.resume();
-                    });
-                }
-
-                void await_resume() {
-                }
-            };
-            return awaitable{&out};
+        ~coalesced_notification_token() {
+            unregister();
         }
 
-    template<typename T>
-    struct observe_task {
-        observe_task(T *cls)
-                : cls(cls)
-                {}
-
-        T *cls;
-        dispatch_queue_t out = dispatch_queue_create("", nullptr);
-        bool await_ready() { return false; }
-
-        internal::bridge::notification_token token;
-        std::shared_ptr<realm::experimental::ObjectChangeCallbackWrapper2<T>> wrapper;
-
-        void await_suspend(coro::coroutine_handle<> h) {
-            __block auto config = cls->m_realm.get_config();
-            __block auto tbl_key = cls->m_obj.get_table().get_key();
-            __block auto obj_key = cls->m_obj.get_key();
-            __block auto _h = h;
-
-            dispatch_async_and_wait(out, ^{
-                config.set_scheduler(realm::util::Scheduler::make_dispatch(out));
-                auto realm = internal::bridge::realm(config);
-                auto table = realm.table_for_key(tbl_key);
-                internal::bridge::object object{std::move(realm), table.get_object(obj_key)};
-                wrapper = std::make_shared<realm::experimental::ObjectChangeCallbackWrapper2<T>>(
-                    cls, object);
-                wrapper->token = object.add_notification_callback(wrapper);
-            });
-            _h();
+        void unregister() {
+            if (m_wrapper) {
+                m_wrapper->deactivate();
+                m_token.unregister();
+            }
         }
 
-        realm::experimental::generator<object_change<T>> await_resume() {
-            std::cout << "resuming!\n";
-            return wrapper->forward_change();
+        [[nodiscard]] notification_stats stats() const {
+            return m_wrapper ? m_wrapper->stats() : notification_stats{};
         }
+
+    private:
+        internal::bridge::notification_token m_token;
+        std::shared_ptr<coalescing_callback_wrapper> m_wrapper;
     };
-#endif
-
-//    template<typename T>
-//    struct observe_task {
-//
-//    };
-//    namespace detail {
-//        template <typename T>
-//        observe_task<T> observe(T* cls) {
-//
-//        }
-//    }
 }
 
 
@@ -6,7 +6,17 @@
 #include <cpprealm/internal/bridge/table.hpp>
 #include <cpprealm/internal/bridge/results.hpp>
 #include <cpprealm/experimental/macros.hpp>
+#include <cpprealm/experimental/observation.hpp>
+#include <cpprealm/page_cursor.hpp>
+#include <cpprealm/query_profiler.hpp>
 #include <cpprealm/schema.hpp>
+#include <cpprealm/task.hpp>
+
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <tuple>
 
 namespace realm {
     class rbool;
@@ -17,6 +27,10 @@ namespace realm::experimental {
 
     template<typename>
     struct results;
+    template<typename, typename...>
+    struct prepared_query;
+    template<typename>
+    struct sorted_results;
 
     template<typename T>
     struct query : public T {
@@ -47,6 +61,8 @@ namespace realm::experimental {
         }
         template<typename>
         friend struct ::realm::experimental::results;
+        template<typename, typename...>
+        friend struct ::realm::experimental::prepared_query;
         friend struct ::realm::mutable_sync_subscription_set;
     };
 
@@ -132,12 +148,30 @@ namespace realm::experimental {
             return m_parent.size();
         }
 
-        results<T> &where(const std::string &query, std::vector<internal::bridge::mixed> arguments) {
-            m_parent = internal::bridge::results(m_parent.get_realm(),
-                                                 m_parent.get_table().query(query, std::move(arguments)));
+        /// Filters the results by a query string. A `std::vector` argument binds a list of
+        /// values, e.g. `where("_id IN $0", {ids})`.
+        results<T> &where(const std::string &query, std::vector<internal::bridge::query_argument> arguments) {
+            auto realm = m_parent.get_realm();
+            auto table = m_parent.get_table();
+            if (internal::bridge::is_query_profiling_enabled()) {
+                m_query.reset();
+                m_parent = internal::bridge::profile_query(realm, [&] {
+                    m_query = table.query(query, arguments);
+                    return *m_query;
+                });
+            } else {
+                m_query = table.query(query, std::move(arguments));
+                m_parent = internal::bridge::results(realm, *m_query);
+            }
             return dynamic_cast<results<T> &>(*this);
         }
 
+        /// Filters the results by a query string with single values as arguments.
+        template<typename Mixed, std::enable_if_t<std::is_same_v<Mixed, internal::bridge::mixed>, int> = 0>
+        results<T> &where(const std::string &query, const std::vector<Mixed>& arguments) {
+            return where(query, std::vector<internal::bridge::query_argument>(arguments.begin(), arguments.end()));
+        }
+
         results<T> &where(std::function<rbool(experimental::managed<T>&)>&& fn) {
             static_assert(sizeof(managed<T>), "Must declare schema for T");
             auto realm = m_parent.get_realm();
@@ -145,14 +179,108 @@ namespace realm::experimental {
             auto group = realm.read_group();
             auto table_ref = group.get_table(schema.table_key());
             auto builder = internal::bridge::query(table_ref);
-            auto q = realm::experimental::query<experimental::managed<T>>(builder, std::move(schema), realm);
-            auto full_query = fn(q).q;
-            m_parent = internal::bridge::results(m_parent.get_realm(), full_query);
+            auto build = [&] {
+                auto q = realm::experimental::query<experimental::managed<T>>(builder, std::move(schema), realm);
+                return fn(q).q;
+            };
+            if (internal::bridge::is_query_profiling_enabled()) {
+                m_query.reset();
+                m_parent = internal::bridge::profile_query(realm, [&] {
+                    m_query = build();
+                    return *m_query;
+                });
+            } else {
+                m_query = build();
+                m_parent = internal::bridge::results(realm, *m_query);
+            }
             return dynamic_cast<results &>(*this);
         }
 
+        /**
+         Describes how the query of these results is evaluated: core's description of the query,
+         the property whose search index is used, if any, and how many objects match. This
+         evaluates the query.
+         */
+        [[nodiscard]] query_explanation explain() {
+            return internal::bridge::explain(m_query ? *m_query : m_parent.get_query());
+        }
+
+        /**
+         Deletes every object in these results in one call into core, rather than building an
+         accessor for each object to pass to `db::remove`. Must be called within a write
+         transaction. Observers are notified of the deletions as for objects removed one at a time.
+         */
+        void remove_all() {
+            m_parent.clear();
+        }
+
+        /**
+         Sets `property` of every object in these results to `value`:
+
+             realm.write([&] {
+                 realm.objects<Person>().where([](auto& p) { return p.age < 18; }).set_all(&Person::age, 18);
+             });
+
+         The value is converted and the column looked up once, and the objects are updated in one
+         pass without building an accessor for each. The objects updated are those which match
+         when this is called, including any which stop matching because of the update. Observers
+         are notified of a modification of each object. Must be called within a write
+         transaction, and only for properties of primitive types other than the primary key.
+         */
+        template<typename V, typename U>
+        void set_all(V T::*property, const U& value) {
+            std::string name = managed<T>::schema.name_for_property(property);
+            if (name.empty()) {
+                throw std::invalid_argument("Only persisted properties can be set on all results.");
+            }
+            auto serialized = serialize(static_cast<const V&>(value));
+            m_parent.set_all(m_parent.get_table().get_column_key(name), internal::bridge::mixed(serialized));
+        }
+
+        /**
+         Sorts these results by `property` to be read a page at a time with keyset pagination:
+
+             auto page = realm.objects<Event>().sorted_by(&Event::ts).after(cursor).take(100);
+             for (auto& event : page) { ... }
+             auto next = page.next_cursor();
+
+         Each page is found by a range condition on the sort key of the last object of the
+         previous page, held by the cursor, so later pages do not evaluate the objects before
+         them as with offsets. Objects with the same sort key are ordered by their primary key.
+         The type must have a primary key, or the sort key must be unique, for no objects to be
+         skipped between pages.
+         */
+        template<typename V>
+        [[nodiscard]] sorted_results<T> sorted_by(V T::*property, bool ascending = true) {
+            std::string name = managed<T>::schema.name_for_property(property);
+            if (name.empty()) {
+                throw std::invalid_argument("Results can only be sorted by persisted properties.");
+            }
+            return sorted_results<T>(m_parent.get_realm(), m_query ? *m_query : m_parent.get_query(),
+                                     std::move(name), ascending);
+        }
+
+        /**
+         Builds a query which can be executed many times with different arguments. The
+         predicate receives the arguments given to `prepared_query::execute` in place of
+         placeholders:
+
+             auto by_age = realm.objects<Person>().prepare<int64_t>([](auto& p, int64_t age) {
+                 return p.age > age;
+             });
+             auto adults = by_age.execute(18);
+
+         The schema lookup and query accessors are set up once, here, instead of on every
+         call as with `where`.
+         */
+        template <typename... Args, typename Fn>
+        prepared_query<T, Args...> prepare(Fn&& fn) {
+            return prepared_query<T, Args...>(m_parent.get_realm(), std::forward<Fn>(fn));
+        }
+
         struct results_callback_wrapper : internal::bridge::collection_change_callback {
             std::function<void(results_change)> handler;
+            std::function<void(collection_range_change)> range_handler;
             results<T> &collection;
             bool ignoreChangesInInitialNotification = true;
 
@@ -160,9 +288,27 @@ namespace realm::experimental {
                                      results<T> &collection)
                 : handler(handler), collection(collection) {}
 
+            results_callback_wrapper(std::function<void(collection_range_change)> handler,
+                                     results<T> &collection)
+                : range_handler(std::move(handler)), collection(collection) {}
+
             void before(const realm::internal::bridge::collection_change_set &c) override {}
 
             void after(internal::bridge::collection_change_set const &changes) final {
+                if (range_handler) {
+                    if (ignoreChangesInInitialNotification) {
+                        ignoreChangesInInitialNotification = false;
+                        range_handler({});
+                    } else if (changes.empty()) {
+                        range_handler({});
+                    } else if (!changes.collection_root_was_deleted() || !changes.deletion_ranges().empty()) {
+                        range_handler({changes.deletion_ranges(),
+                                       changes.insertion_ranges(),
+                                       changes.modification_ranges(),
+                                       changes.collection_root_was_deleted()});
+                    }
+                    return;
+                }
                 if (ignoreChangesInInitialNotification) {
                     ignoreChangesInInitialNotification = false;
                     handler({&collection, {}, {}, {}});
@@ -193,6 +339,88 @@ namespace realm::experimental {
                     std::make_shared<results_callback_wrapper>(std::move(handler), dynamic_cast<results<T> &>(*this)));
         }
 
+        /**
+         Observe these results with change sets given as index ranges rather than one
+         entry per index. See `collection_range_change` for the lifetime of the ranges.
+         */
+        internal::bridge::notification_token observe_ranges(std::function<void(collection_range_change)> &&handler) {
+            return m_parent.add_notification_callback(
+                    std::make_shared<results_callback_wrapper>(std::move(handler), dynamic_cast<results<T> &>(*this)));
+        }
+
+        /**
+         Observe these results, only waking up for insertions, deletions and changes
+         to the given properties of the objects in them.
+         */
+        internal::bridge::notification_token observe(std::function<void(results_change)> &&handler,
+                                                     const std::vector<property_key_path<T>> &key_paths) {
+            auto table = m_parent.get_table();
+            return m_parent.add_notification_callback(
+                    std::make_shared<results_callback_wrapper>(std::move(handler), dynamic_cast<results<T> &>(*this)),
+                    property_key_path<T>::to_key_path_array(table, key_paths));
+        }
+
+        /**
+         Observe these results with notifications coalesced according to `options`.
+         Changes committed while a notification is held back are merged into it, and the
+         handler is invoked at most once per `options.min_interval`.
+         */
+        coalesced_notification_token observe_coalesced(std::function<void(coalesced_change)> &&handler,
+                                                       const coalescing_options &options) {
+            auto wrapper = std::make_shared<coalescing_callback_wrapper>(std::move(handler), options,
+                                                                         m_parent.get_realm().scheduler());
+            auto token = m_parent.add_notification_callback(wrapper);
+            return coalesced_notification_token(std::move(token), std::move(wrapper));
+        }
+
+#ifdef CPPREALM_HAVE_COROUTINES
+        struct change_awaitable {
+            results<T> &collection;
+            internal::bridge::notification_token token;
+            std::optional<results_change> change;
+
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(coro::coroutine_handle<> h) {
+                token = collection.observe([this, h, initial = true](results_change c) mutable {
+                    if (std::exchange(initial, false) || change) {
+                        return;
+                    }
+                    change = std::move(c);
+                    internal::resume_on(collection.m_parent.get_realm().scheduler(), h);
+                });
+            }
+            results_change await_resume() {
+                token.unregister();
+                return std::move(*change);
+            }
+        };
+
+        /**
+         Suspends the awaiting coroutine until the next change to these results is
+         committed and resumes it on the Realm's scheduler with the change set.
+         */
+        [[nodiscard]] change_awaitable first_change() {
+            return {*this, {}, std::nullopt};
+        }
+
+        /**
+         Returns an asynchronous generator yielding every change to these results,
+         starting with the first change after this call. Changes which arrive while
+         the consumer is busy are buffered. The results must outlive the generator.
+         */
+        [[nodiscard]] async_generator<results_change> changes() {
+            using state = typename async_generator<results_change>::state;
+            auto s = std::make_shared<state>();
+            s->scheduler = m_parent.get_realm().scheduler();
+            auto token = observe([s, initial = true](results_change c) mutable {
+                if (!std::exchange(initial, false)) {
+                    s->push(std::move(c));
+                }
+            });
+            return async_generator<results_change>(s, std::move(token));
+        }
+#endif
+
         explicit results(internal::bridge::results &&parent)
             : m_parent(parent) {
         }
@@ -205,9 +433,149 @@ namespace realm::experimental {
 
     protected:
         internal::bridge::results m_parent;
+        // The query built by `where`, which knows the conditions it was built from.
+        std::optional<internal::bridge::query> m_query;
         template <auto> friend struct linking_objects;
     };
 
+    /**
+     A type-safe query built once by `results<T>::prepare` and executed with new arguments.
+     Executing it again with the same arguments as the previous execution reuses the
+     previously built query. Copies share their state.
+     */
+    template <typename T, typename... Args>
+    struct prepared_query {
+        using predicate = std::function<rbool(experimental::managed<T>&, const Args&...)>;
+
+        // Returns the objects matching the predicate for `args`.
+        results<T> execute(const Args&... args) {
+            auto& s = *m_state;
+            auto build = [&] {
+                if (!s.last_args || !equal_args(*s.last_args, std::tie(args...))) {
+                    s.last_query = s.fn(*s.accessor, args...).q;
+                    s.last_args.emplace(args...);
+                }
+                return s.last_query;
+            };
+            if (internal::bridge::is_query_profiling_enabled()) {
+                return results<T>(internal::bridge::profile_query(*s.realm, build));
+            }
+            build();
+            return results<T>(internal::bridge::results(*s.realm, s.last_query));
+        }
+
+    private:
+        prepared_query(const internal::bridge::realm& r, predicate&& fn) : m_state(std::make_shared<state>()) {
+            auto& s = *m_state;
+            s.fn = std::move(fn);
+            s.realm = std::make_unique<internal::bridge::realm>(r);
+            auto schema = s.realm->schema().find(managed<T>::schema.name);
+            auto group = s.realm->read_group();
+            s.builder = std::make_unique<internal::bridge::query>(group.get_table(schema.table_key()));
+            s.accessor.reset(new query<managed<T>>(*s.builder, std::move(schema), *s.realm));
+        }
+
+        template <typename V, typename = void>
+        struct is_equality_comparable : std::false_type {};
+        template <typename V>
+        struct is_equality_comparable<V, std::void_t<decltype(std::declval<const V&>() == std::declval<const V&>())>>
+            : std::true_type {};
+
+        template <size_t... Is>
+        static bool equal_args(const std::tuple<Args...>& lhs, const std::tuple<const Args&...>& rhs,
+                               std::index_sequence<Is...>) {
+            return ((std::get<Is>(lhs) == std::get<Is>(rhs)) && ...);
+        }
+        static bool equal_args(const std::tuple<Args...>& lhs, const std::tuple<const Args&...>& rhs) {
+            if constexpr ((is_equality_comparable<Args>::value && ...)) {
+                return equal_args(lhs, rhs, std::index_sequence_for<Args...>());
+            } else {
+                return false;
+            }
+        }
+
+        // The accessors refer to the realm and query builder, so these are kept at a stable address.
+        struct state {
+            predicate fn;
+            std::unique_ptr<internal::bridge::realm> realm;
+            std::unique_ptr<internal::bridge::query> builder;
+            std::unique_ptr<query<managed<T>>> accessor;
+            std::optional<std::tuple<Args...>> last_args;
+            internal::bridge::query last_query;
+        };
+        std::shared_ptr<state> m_state;
+
+        friend struct results<T>;
+    };
+
+    /**
+     One page of results sorted by `results<T>::sorted_by`.
+     */
+    template <typename T>
+    struct results_page : results<T> {
+        /// The position after the last object of this page, from which the next page is read,
+        /// or none if this page has fewer objects than were asked for and so is the last one.
+        [[nodiscard]] std::optional<page_cursor> next_cursor() {
+            auto size = this->m_parent.size();
+            if (size == 0 || size < m_count) {
+                return std::nullopt;
+            }
+            return internal::bridge::make_page_cursor(internal::bridge::get<internal::bridge::obj>(this->m_parent, size - 1),
+                                                      m_property, m_ascending);
+        }
+
+    private:
+        results_page(internal::bridge::results&& parent, std::string property, bool ascending, size_t count)
+            : results<T>(std::move(parent)), m_property(std::move(property)), m_ascending(ascending), m_count(count) {}
+
+        std::string m_property;
+        bool m_ascending;
+        size_t m_count;
+
+        friend struct sorted_results<T>;
+    };
+
+    /**
+     Results sorted by one property, which are read a page at a time from a cursor. See
+     `results<T>::sorted_by`.
+     */
+    template <typename T>
+    struct sorted_results {
+        /// Reads the pages after `cursor`. `take()` throws `std::invalid_argument` if the cursor
+        /// was returned for results sorted by another property or order.
+        [[nodiscard]] sorted_results after(page_cursor cursor) const {
+            auto ret = *this;
+            ret.m_cursor = std::move(cursor);
+            return ret;
+        }
+
+        /// The first `count` objects after the cursor. The page is a range query on the sort key
+        /// limited to `count` objects, and is updated by later writes as other results are.
+        [[nodiscard]] results_page<T> take(size_t count) const {
+            auto q = m_query;
+            auto table = q.get_table();
+            if (!m_cursor.is_start()) {
+                q = q.and_query(internal::bridge::page_query(table, m_property, m_ascending, m_cursor));
+            }
+            auto page = internal::bridge::results(m_realm, q)
+                                .sort(internal::bridge::page_ordering(table, m_property, m_ascending))
+                                .limit(count);
+            return results_page<T>(std::move(page), m_property, m_ascending, count);
+        }
+
+    private:
+        sorted_results(internal::bridge::realm&& realm, internal::bridge::query&& query, std::string&& property, bool ascending)
+            : m_realm(std::move(realm)), m_query(std::move(query)), m_property(std::move(property)), m_ascending(ascending) {}
+
+        internal::bridge::realm m_realm;
+        internal::bridge::query m_query;
+        std::string m_property;
+        bool m_ascending;
+        page_cursor m_cursor;
+
+        friend struct results<T>;
+    };
+
     template <auto ptr>
     struct linking_objects {
         static inline auto Ptr = ptr;
@@ -220,43 +588,76 @@ namespace realm::experimental {
         using iterator = typename results<typename internal::ptr_type_extractor<ptr>::class_type>::iterator;
         using Class = typename internal::ptr_type_extractor<ptr>::class_type;
 
+        void assign(internal::bridge::obj *obj,
+                    internal::bridge::realm* realm,
+                    const internal::bridge::col_key &key) {
+            m_origin.reset();
+            m_results.reset();
+            managed_base::assign(obj, realm, key);
+        }
+
         linking_objects<ptr> detach() const {
             return {};
         }
 
         iterator begin() {
-            return iterator(0, get_results());
+            return iterator(0, &get_results());
         }
 
         iterator end() {
-            auto r = get_results();
-            return iterator(r.size(), r);
+            auto& r = get_results();
+            return iterator(r.size(), &r);
         }
 
         size_t size() {
             return get_results().size();
         }
+
+        /// The number of objects linking to this one, counted without building a view of them.
+        [[nodiscard]] size_t count() const {
+            check_valid();
+            auto& [origin_table, origin_col] = origin();
+            return m_obj->get_backlink_count(origin_table, origin_col);
+        }
+
         managed<Class> operator[](size_t idx) {
             return get_results()[idx];
         }
     private:
-
-        results<Class> get_results() {
+        void check_valid() const {
             auto table = m_obj->get_table();
             if (!table.is_valid(m_obj->get_key())) {
                 throw std::logic_error("Object has been deleted or invalidated.");
             }
+        }
 
-            internal::bridge::obj* obj = m_obj;
-            auto schema = m_realm->schema().find(managed<Class>::schema.name);
-            auto linking_property = schema.property_for_name(managed<Class>::schema.template name_for_property<ptr>());
-            if (!linking_property.column_key()) {
-                throw std::logic_error("Invalid column key for origin property.");
+        // The origin table and column of the backlinks, resolved once per accessor.
+        const std::pair<internal::bridge::table, internal::bridge::col_key>& origin() const {
+            if (!m_origin) {
+                auto schema = m_realm->schema().find(managed<Class>::schema.name);
+                auto linking_property = schema.property_for_name(managed<Class>::schema.template name_for_property<ptr>());
+                if (!linking_property.column_key()) {
+                    throw std::logic_error("Invalid column key for origin property.");
+                }
+                m_origin.emplace(m_realm->get_table(schema.table_key()), linking_property.column_key());
             }
+            return *m_origin;
+        }
 
-            internal::bridge::results results(*m_realm, obj->get_backlink_view(m_realm->get_table(schema.table_key()), linking_property.column_key()));
-            return ::realm::experimental::results<Class>(std::move(results));
+        // The backlink view is built once and reused. It is brought up to date by the Realm
+        // when it is next accessed after the Realm has advanced to a new version.
+        results<Class>& get_results() {
+            check_valid();
+            if (!m_results) {
+                auto& [origin_table, origin_col] = origin();
+                internal::bridge::results results(*m_realm, m_obj->get_backlink_view(origin_table, origin_col));
+                m_results = std::make_shared<::realm::experimental::results<Class>>(std::move(results));
+            }
+            return *m_results;
         }
+
+        mutable std::optional<std::pair<internal::bridge::table, internal::bridge::col_key>> m_origin;
+        std::shared_ptr<results<Class>> m_results;
     };
 }
 
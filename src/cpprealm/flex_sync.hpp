@@ -23,9 +23,11 @@
 #include <type_traits>
 
 #include <cpprealm/alpha_support.hpp>
+#include <cpprealm/internal/bridge/mixed.hpp>
 #include <cpprealm/internal/bridge/obj.hpp>
 #include <cpprealm/internal/bridge/query.hpp>
 #include <cpprealm/internal/bridge/schema.hpp>
+#include <cpprealm/internal/bridge/table.hpp>
 #include <cpprealm/internal/bridge/realm.hpp>
 #include <cpprealm/internal/bridge/utils.hpp>
 
@@ -129,6 +131,26 @@ namespace realm {
             }
         }
 
+        // Inserts a new subscription into the set if one does not exist already, syncing
+        // the objects matching the query string. The parsed query is shared with
+        // `results<T>::where`, see `get_query_cache_stats`.
+        template<typename T>
+        std::enable_if_t<!std::is_base_of_v<object<T>, T>>
+        add(const std::string &name, const std::string &query,
+            const std::vector<internal::bridge::query_argument> &arguments = {}) {
+            static_assert(sizeof(experimental::managed<T>), "Must declare schema for T");
+
+            auto schema = m_realm.get().schema().find(experimental::managed<T>::schema.name);
+            auto group = m_realm.get().read_group();
+            auto table_ref = group.get_table(schema.table_key());
+            insert_or_assign(name, table_ref.query(query, arguments));
+        }
+        template<typename T, typename Mixed>
+        std::enable_if_t<!std::is_base_of_v<object<T>, T> && std::is_same_v<Mixed, internal::bridge::mixed>>
+        add(const std::string &name, const std::string &query, const std::vector<Mixed> &arguments) {
+            add<T>(name, query, std::vector<internal::bridge::query_argument>(arguments.begin(), arguments.end()));
+        }
+
         // Removes a subscription for a given name. Will throw if subscription does
         // not exist.
         void remove(const std::string& name);
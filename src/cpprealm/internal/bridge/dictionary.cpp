@@ -1,11 +1,24 @@
 #include <cpprealm/internal/bridge/dictionary.hpp>
+#include <cpprealm/internal/bridge/col_key.hpp>
 #include <cpprealm/internal/bridge/mixed.hpp>
 #include <cpprealm/internal/bridge/obj.hpp>
 #include <cpprealm/internal/bridge/object.hpp>
+#include <cpprealm/internal/bridge/realm.hpp>
 
 #include <realm/object-store/dictionary.hpp>
 #include <realm/object-store/results.hpp>
 
+namespace realm {
+    size_t dictionary_key_view::size() const noexcept {
+        return m_keys ? m_keys->size() : 0;
+    }
+
+    std::string_view dictionary_key_view::operator[](size_t i) const {
+        auto key = (*m_keys)[i].get_string();
+        return std::string_view(key.data(), key.size());
+    }
+}
+
 namespace realm::internal::bridge {
 
     core_dictionary::core_dictionary() {
@@ -83,35 +96,35 @@ namespace realm::internal::bridge {
         return *get_dictionary();
     }
 
-    void core_dictionary::insert(const std::string& key, const mixed& value) {
-        get_dictionary()->insert(key, value.operator Mixed());
+    void core_dictionary::insert(std::string_view key, const mixed& value) {
+        get_dictionary()->insert(StringData(key), value.operator Mixed());
     }
 
-    void core_dictionary::insert(const std::string& key, const std::string& value) {
-        get_dictionary()->insert(key, value);
+    void core_dictionary::insert(std::string_view key, const std::string& value) {
+        get_dictionary()->insert(StringData(key), StringData(value));
     }
 
-    obj core_dictionary::create_and_insert_linked_object(const std::string& key, const internal::bridge::mixed& pk) {
+    obj core_dictionary::create_and_insert_linked_object(std::string_view key, const internal::bridge::mixed& pk) {
         Table& t = *get_dictionary()->get_target_table();
         auto o = t.create_object_with_primary_key(pk.operator Mixed());
-        get_dictionary()->insert(key, o.get_key());
+        get_dictionary()->insert(StringData(key), o.get_key());
         return o;
     }
 
-    obj core_dictionary::create_and_insert_linked_object(const std::string& key) {
-        return get_dictionary()->create_and_insert_linked_object(key);
+    obj core_dictionary::create_and_insert_linked_object(std::string_view key) {
+        return get_dictionary()->create_and_insert_linked_object(StringData(key));
     }
 
-    mixed core_dictionary::get(const std::string& key) const {
-        return get_dictionary()->get(key);
+    mixed core_dictionary::get(std::string_view key) const {
+        return get_dictionary()->get(StringData(key));
     }
 
-    void core_dictionary::erase(const std::string& key) {
-        get_dictionary()->erase(key);
+    void core_dictionary::erase(std::string_view key) {
+        get_dictionary()->erase(StringData(key));
     }
 
-    obj core_dictionary::get_object(const std::string& key) {
-        return get_dictionary()->get_object(key);
+    obj core_dictionary::get_object(std::string_view key) {
+        return get_dictionary()->get_object(StringData(key));
     }
 
     size_t core_dictionary::size() const {
@@ -122,8 +135,8 @@ namespace realm::internal::bridge {
         return get_dictionary()->get_pair(ndx);
     }
 
-    size_t core_dictionary::find_any_key(const std::string& value) const noexcept {
-        return get_dictionary()->find_any_key(value);
+    size_t core_dictionary::find_any_key(std::string_view value) const noexcept {
+        return get_dictionary()->find_any_key(StringData(value));
     }
 
     dictionary::dictionary() {
@@ -186,6 +199,14 @@ namespace realm::internal::bridge {
 #endif
     }
 
+    dictionary::dictionary(const realm& realm, const obj& obj, const col_key& col_key) {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        new (&m_dictionary) Dictionary(realm.operator std::shared_ptr<Realm>(), obj, col_key);
+#else
+        m_dictionary = std::make_shared<Dictionary>(realm.operator std::shared_ptr<Realm>(), obj, col_key);
+#endif
+    }
+
     const Dictionary* dictionary::get_dictionary() const {
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         return reinterpret_cast<const Dictionary*>(&m_dictionary);
@@ -204,10 +225,17 @@ namespace realm::internal::bridge {
     dictionary::operator Dictionary() const {
         return *get_dictionary();
     }
+    dictionary::operator core_dictionary() const {
+        return static_cast<const CoreDictionary&>(get_dictionary()->get_impl());
+    }
     size_t dictionary::size() const {
         return get_dictionary()->size();
     }
 
+    bool dictionary::is_valid() const {
+        return get_dictionary()->is_valid();
+    }
+
     void dictionary::insert(const std::string &key, const mixed &value) {
         get_dictionary()->insert_any(key, static_cast<Mixed>(value.operator ::realm::Mixed()));
     }
@@ -346,7 +374,67 @@ namespace realm::internal::bridge {
         return get_dictionary()->add_key_based_notification_callback(wrapper);
     }
 
+    notification_token dictionary::add_key_based_notification_callback(std::shared_ptr<dictionary_key_callback_wrapper>&& cb) {
+        struct wrapper {
+            std::shared_ptr<dictionary_key_callback_wrapper> m_cb;
+            explicit wrapper(std::shared_ptr<dictionary_key_callback_wrapper>&& c) : m_cb(std::move(c)) {}
+
+            void operator()(DictionaryChangeSet const& changes) {
+                dictionary_key_change change;
+                change.insertions = dictionary_key_view(changes.insertions);
+                change.modifications = dictionary_key_view(changes.modifications);
+                change.deletions = dictionary_key_view(changes.deletions);
+                change.collection_root_was_deleted = changes.collection_root_was_deleted;
+                m_cb->handler(std::move(change));
+            }
+        } wrapper(std::move(cb));
+        return get_dictionary()->add_key_based_notification_callback(wrapper);
+    }
+
     obj dictionary::insert_embedded(const std::string &v) {
         return get_dictionary()->insert_embedded(v);
     }
+
+    bool dictionary::contains(std::string_view key) const {
+        return get_dictionary()->contains(StringData(key));
+    }
+
+    std::optional<mixed> dictionary::try_get(std::string_view key) const {
+        if (auto v = get_dictionary()->try_get_any(StringData(key))) {
+            return mixed(*v);
+        }
+        return std::nullopt;
+    }
+
+    void dictionary::get_many(const std::vector<std::string_view>& keys, std::vector<std::optional<mixed>>& out) const {
+        auto d = get_dictionary();
+        out.reserve(out.size() + keys.size());
+        for (auto& key : keys) {
+            if (auto v = d->try_get_any(StringData(key))) {
+                out.emplace_back(mixed(*v));
+            } else {
+                out.emplace_back(std::nullopt);
+            }
+        }
+    }
+
+    void dictionary::insert_many(const std::vector<std::pair<std::string_view, mixed>>& values) {
+        auto d = get_dictionary();
+        for (auto& [key, value] : values) {
+            d->insert_any(StringData(key), value.operator ::realm::Mixed());
+        }
+    }
+
+    void dictionary::erase(std::string_view key) {
+        get_dictionary()->erase(StringData(key));
+    }
+
+    size_t dictionary::find_any_key(std::string_view key) const noexcept {
+        return static_cast<const CoreDictionary&>(get_dictionary()->get_impl()).find_any_key(StringData(key));
+    }
+
+    std::pair<std::string_view, mixed> dictionary::get_entry(size_t ndx) const {
+        auto pair = get_dictionary()->get_pair(ndx);
+        return { std::string_view(pair.first.data(), pair.first.size()), mixed(pair.second) };
+    }
 }
@@ -2,8 +2,11 @@
 #define CPP_REALM_BRIDGE_DICTIONARY_HPP
 
 #include <functional>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <cpprealm/internal/bridge/utils.hpp>
 
@@ -11,8 +14,13 @@ namespace realm::object_store {
     class Dictionary;
 }
 
+namespace realm::internal::bridge {
+    struct dictionary;
+}
+
 namespace realm {
     class Dictionary;
+    class Mixed;
     using CoreDictionary = Dictionary;
     struct dictionary_change_set {
         dictionary_change_set(const dictionary_change_set&);
@@ -59,6 +67,66 @@ namespace realm {
         }
     };
 
+    /**
+     A non-owning view of the keys in a dictionary change.
+
+     The keys point into the versions of the dictionary the change was calculated
+     between, so nothing is copied when the change is delivered, but the view and the
+     `std::string_view`s it yields are only valid for the duration of the callback.
+     */
+    struct dictionary_key_view {
+        class iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const std::string_view*;
+            using reference = std::string_view;
+
+            std::string_view operator*() const { return (*m_view)[m_i]; }
+            iterator& operator++() { ++m_i; return *this; }
+            bool operator==(const iterator& other) const { return m_i == other.m_i; }
+            bool operator!=(const iterator& other) const { return m_i != other.m_i; }
+        private:
+            friend struct dictionary_key_view;
+            iterator(const dictionary_key_view* view, size_t i) : m_view(view), m_i(i) {}
+            const dictionary_key_view* m_view;
+            size_t m_i;
+        };
+
+        dictionary_key_view() = default;
+
+        [[nodiscard]] size_t size() const noexcept;
+        [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+        std::string_view operator[](size_t i) const;
+        [[nodiscard]] iterator begin() const { return iterator(this, 0); }
+        [[nodiscard]] iterator end() const { return iterator(this, size()); }
+
+    private:
+        friend struct internal::bridge::dictionary;
+        explicit dictionary_key_view(const std::vector<Mixed>& keys) : m_keys(&keys) {}
+        const std::vector<Mixed>* m_keys = nullptr;
+    };
+
+    struct dictionary_key_change {
+        dictionary_key_view insertions;
+        dictionary_key_view modifications;
+        dictionary_key_view deletions;
+        bool collection_root_was_deleted = false;
+
+        [[nodiscard]] bool empty() const noexcept {
+            return deletions.empty() && insertions.empty() && modifications.empty() &&
+                   !collection_root_was_deleted;
+        }
+    };
+
+    struct dictionary_key_callback_wrapper {
+        std::function<void(dictionary_key_change)> handler;
+
+        explicit dictionary_key_callback_wrapper(std::function<void(dictionary_key_change)> handler)
+            : handler(std::move(handler)) {}
+    };
+
     struct dictionary_callback_wrapper {
         std::function<void(dictionary_collection_change)> handler;
         bool ignore_changes_in_initial_notification;
@@ -84,6 +152,8 @@ namespace realm::internal::bridge {
     struct notification_token;
     struct collection_change_callback;
     struct obj;
+    struct realm;
+    struct col_key;
 
     struct core_dictionary {
         core_dictionary();
@@ -95,15 +165,15 @@ namespace realm::internal::bridge {
 
         core_dictionary(const CoreDictionary& v); //NOLINT(google-explicit-constructor)
         operator CoreDictionary () const; //NOLINT(google-explicit-constructor)
-        void insert(const std::string& key, const mixed& value);
-        void insert(const std::string& key, const std::string& value);
-        obj create_and_insert_linked_object(const std::string& key);
-        obj create_and_insert_linked_object(const std::string& key, const internal::bridge::mixed& pk);
-        mixed get(const std::string& key) const;
-        void erase(const std::string& key);
-        obj get_object(const std::string& key);
+        void insert(std::string_view key, const mixed& value);
+        void insert(std::string_view key, const std::string& value);
+        obj create_and_insert_linked_object(std::string_view key);
+        obj create_and_insert_linked_object(std::string_view key, const internal::bridge::mixed& pk);
+        mixed get(std::string_view key) const;
+        void erase(std::string_view key);
+        obj get_object(std::string_view key);
         std::pair<mixed, mixed> get_pair(size_t ndx) const;
-        size_t find_any_key(const std::string& value) const noexcept;
+        size_t find_any_key(std::string_view value) const noexcept;
 
         size_t size() const;
     private:
@@ -125,7 +195,10 @@ namespace realm::internal::bridge {
         dictionary& operator=(dictionary&& other);
         ~dictionary();
         dictionary(const Dictionary& v); //NOLINT(google-explicit-constructor)
+        dictionary(const realm& realm, const obj& obj, const col_key& col_key);
         operator Dictionary() const; //NOLINT(google-explicit-constructor)
+        operator core_dictionary() const; //NOLINT(google-explicit-constructor)
+        [[nodiscard]] bool is_valid() const;
         void insert(const std::string& key, const mixed& value);
         void insert(const std::string &key, const std::string &value);
         [[nodiscard]] size_t size() const;
@@ -136,8 +209,23 @@ namespace realm::internal::bridge {
         void clear();
         [[nodiscard]] size_t find(const std::string&);
         obj insert_embedded(const std::string&);
+
+        // Lookups by borrowed key. None of these copy the key.
+        [[nodiscard]] bool contains(std::string_view key) const;
+        [[nodiscard]] std::optional<mixed> try_get(std::string_view key) const;
+        // Appends one entry to `out` per key, std::nullopt where the key is absent.
+        void get_many(const std::vector<std::string_view>& keys, std::vector<std::optional<mixed>>& out) const;
+        void insert_many(const std::vector<std::pair<std::string_view, mixed>>& values);
+        // Throws if the dictionary does not contain `key`.
+        void erase(std::string_view key);
+        // The index of `key`, or `size_t(-1)` if the dictionary does not contain it.
+        [[nodiscard]] size_t find_any_key(std::string_view key) const noexcept;
+        // The key is a view into the Realm file and is only valid until the Realm
+        // is written to or advances to a new version.
+        [[nodiscard]] std::pair<std::string_view, mixed> get_entry(size_t ndx) const;
         notification_token add_notification_callback(std::shared_ptr<collection_change_callback>&& cb);
         notification_token add_key_based_notification_callback(std::shared_ptr<dictionary_callback_wrapper>&& cb);
+        notification_token add_key_based_notification_callback(std::shared_ptr<dictionary_key_callback_wrapper>&& cb);
     private:
         const Dictionary* get_dictionary() const;
         Dictionary* get_dictionary();
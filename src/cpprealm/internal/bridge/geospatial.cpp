@@ -0,0 +1,61 @@
+#include <cpprealm/internal/bridge/geospatial.hpp>
+
+#include <realm/query.hpp>
+#if REALM_ENABLE_GEOSPATIAL
+#include <realm/geospatial.hpp>
+#endif
+
+#include <stdexcept>
+
+namespace realm::internal::bridge {
+    geospatial geospatial::box(point lower_left, point upper_right) {
+        return geospatial(kind::box, {{lower_left, upper_right}});
+    }
+
+    geospatial geospatial::circle(point center, double radius_radians) {
+        return geospatial(kind::circle, {{center}}, radius_radians);
+    }
+
+    geospatial geospatial::polygon(std::vector<std::vector<point>> rings) {
+        return geospatial(kind::polygon, std::move(rings));
+    }
+
+#if REALM_ENABLE_GEOSPATIAL
+    geospatial::operator Geospatial() const {
+        auto to_core = [](const point& p) {
+            return GeoPoint(p.longitude, p.latitude);
+        };
+        switch (m_kind) {
+            case kind::box:
+                return Geospatial(GeoBox{to_core(m_points[0][0]), to_core(m_points[0][1])});
+            case kind::circle:
+                return Geospatial(GeoCircle{to_core(m_points[0][0]), m_radius});
+            case kind::polygon: {
+                std::vector<std::vector<GeoPoint>> rings;
+                rings.reserve(m_points.size());
+                for (auto& ring : m_points) {
+                    auto& core_ring = rings.emplace_back();
+                    core_ring.reserve(ring.size());
+                    for (auto& p : ring) {
+                        core_ring.push_back(to_core(p));
+                    }
+                }
+                return Geospatial(GeoPolygon(std::move(rings)));
+            }
+        }
+        throw std::logic_error("Unknown geospatial shape.");
+    }
+
+    bool geospatial::contains(point p) const {
+        GeoRegion region(*this);
+        if (auto status = region.get_conversion_status(); !status.is_ok()) {
+            throw std::invalid_argument(status.reason());
+        }
+        return region.contains(GeoPoint(p.longitude, p.latitude));
+    }
+#else
+    bool geospatial::contains(point) const {
+        throw std::runtime_error("Geospatial queries are not supported by this build of Realm Core.");
+    }
+#endif
+}
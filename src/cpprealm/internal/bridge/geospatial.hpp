@@ -0,0 +1,43 @@
+#ifndef CPP_REALM_BRIDGE_GEOSPATIAL_HPP
+#define CPP_REALM_BRIDGE_GEOSPATIAL_HPP
+
+#include <optional>
+#include <vector>
+
+namespace realm {
+    class Geospatial;
+}
+
+namespace realm::internal::bridge {
+    /**
+     A region of the earth for geospatial queries, as a box, a circle or a polygon whose
+     points are given in degrees of longitude and latitude.
+     */
+    struct geospatial {
+        struct point {
+            double longitude;
+            double latitude;
+        };
+
+        static geospatial box(point lower_left, point upper_right);
+        static geospatial circle(point center, double radius_radians);
+        // The first ring is the outer boundary and any others are holes, each closed by
+        // repeating its first point at the end.
+        static geospatial polygon(std::vector<std::vector<point>> rings);
+
+        // Whether `p` lies within the region, as evaluated by geospatial queries.
+        [[nodiscard]] bool contains(point p) const;
+
+        operator Geospatial() const; //NOLINT(google-explicit-constructor)
+    private:
+        enum class kind { box, circle, polygon };
+        geospatial(kind k, std::vector<std::vector<point>>&& points, double radius = 0)
+            : m_kind(k), m_points(std::move(points)), m_radius(radius) {}
+
+        kind m_kind;
+        std::vector<std::vector<point>> m_points;
+        double m_radius;
+    };
+}
+
+#endif //CPP_REALM_BRIDGE_GEOSPATIAL_HPP
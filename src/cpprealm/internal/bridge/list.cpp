@@ -7,6 +7,8 @@
 
 #include <realm/object-store/list.hpp>
 
+#include <cstring>
+
 namespace realm::internal::bridge {
 
     list::list() {
@@ -123,6 +125,23 @@ namespace realm::internal::bridge {
     size_t list::size() const {
         return get_list()->size();
     }
+    bool list::is_valid() const {
+        return get_list()->is_valid();
+    }
+
+    size_t list::get_binary_size(size_t idx) const {
+        return get_list()->get<BinaryData>(idx).size();
+    }
+
+    size_t list::read_binary(size_t idx, size_t offset, uint8_t* dest, size_t count) const {
+        auto data = get_list()->get<BinaryData>(idx);
+        if (offset >= data.size()) {
+            return 0;
+        }
+        count = std::min(count, data.size() - offset);
+        std::memcpy(dest, data.data() + offset, count);
+        return count;
+    }
     void list::remove(size_t idx) {
         get_list()->remove(idx);
     }
@@ -166,6 +185,18 @@ namespace realm::internal::bridge {
     obj list::add_embedded() {
         return get_list()->add_embedded();
     }
+    void list::insert_range(size_t pos, const std::vector<mixed>& values) {
+        auto list = get_list();
+        for (auto& v : values) {
+            list->insert_any(pos++, v.operator ::realm::Mixed());
+        }
+    }
+    void list::insert_range(size_t pos, const std::vector<obj_key>& values) {
+        auto list = get_list();
+        for (auto& v : values) {
+            list->insert(pos++, static_cast<ObjKey>(v));
+        }
+    }
 
     template <>
     std::string get(const list& lst, size_t idx) {
@@ -311,4 +342,33 @@ namespace realm::internal::bridge {
         } ccb(std::move(cb));
         return get_list()->add_notification_callback(ccb);
     }
+
+    template <typename ValueType>
+    void get_range(const list& lst, size_t begin, size_t end, std::vector<ValueType>& out) {
+        out.clear();
+        out.reserve(end - begin);
+        for (size_t i = begin; i < end; i++) {
+            out.push_back(get<ValueType>(lst, i));
+        }
+    }
+
+    template void get_range(const list&, size_t, size_t, std::vector<std::string>&);
+    template void get_range(const list&, size_t, size_t, std::vector<int64_t>&);
+    template void get_range(const list&, size_t, size_t, std::vector<double>&);
+    template void get_range(const list&, size_t, size_t, std::vector<bool>&);
+    template void get_range(const list&, size_t, size_t, std::vector<binary>&);
+    template void get_range(const list&, size_t, size_t, std::vector<uuid>&);
+    template void get_range(const list&, size_t, size_t, std::vector<object_id>&);
+    template void get_range(const list&, size_t, size_t, std::vector<decimal128>&);
+    template void get_range(const list&, size_t, size_t, std::vector<mixed>&);
+    template void get_range(const list&, size_t, size_t, std::vector<timestamp>&);
+    template void get_range(const list&, size_t, size_t, std::vector<std::optional<int64_t>>&);
+    template void get_range(const list&, size_t, size_t, std::vector<std::optional<double>>&);
+    template void get_range(const list&, size_t, size_t, std::vector<std::optional<bool>>&);
+    template void get_range(const list&, size_t, size_t, std::vector<std::optional<uuid>>&);
+    template void get_range(const list&, size_t, size_t, std::vector<std::optional<object_id>>&);
+    template void get_range(const list&, size_t, size_t, std::vector<std::optional<std::string>>&);
+    template void get_range(const list&, size_t, size_t, std::vector<std::optional<binary>>&);
+    template void get_range(const list&, size_t, size_t, std::vector<std::optional<timestamp>>&);
+    template void get_range(const list&, size_t, size_t, std::vector<std::optional<decimal128>>&);
 }
@@ -5,6 +5,7 @@
 #include <string>
 #include <memory>
 #include <optional>
+#include <vector>
 #include <cpprealm/internal/bridge/utils.hpp>
 
 namespace realm {
@@ -44,6 +45,12 @@ namespace realm::internal::bridge {
         list(const realm& realm, const obj& obj, const col_key&);
 
         [[nodiscard]] size_t size() const;
+        // Whether the list can still be accessed, i.e. its Realm is open and its parent object exists.
+        [[nodiscard]] bool is_valid() const;
+        // Reads part of a binary element in place, without copying the rest of it.
+        // Returns the number of bytes copied into `dest`.
+        [[nodiscard]] size_t get_binary_size(size_t idx) const;
+        size_t read_binary(size_t idx, size_t offset, uint8_t* dest, size_t count) const;
         void remove(size_t idx);
         void remove_all();
 
@@ -61,6 +68,9 @@ namespace realm::internal::bridge {
         void add(const obj_key &);
         void add(const timestamp &);
         obj add_embedded();
+        // Inserts `values` at `pos` in order, with a single call into the bridge.
+        void insert_range(size_t pos, const std::vector<mixed>& values);
+        void insert_range(size_t pos, const std::vector<obj_key>& values);
 
         void set(size_t pos, const int64_t &);
         void set(size_t pos, const double &);
@@ -120,6 +130,11 @@ namespace realm::internal::bridge {
     template <>
     [[nodiscard]] obj get(const list&, size_t idx);
 
+    template <>
+    [[nodiscard]] bool get(const list&, size_t idx);
+    template <>
+    [[nodiscard]] timestamp get(const list&, size_t idx);
+
     template <>
     [[nodiscard]] std::optional<int64_t> get(const list& lst, size_t idx);
     template <>
@@ -136,6 +151,14 @@ namespace realm::internal::bridge {
     [[nodiscard]] std::optional<binary> get(const list& lst, size_t idx);
     template <>
     [[nodiscard]] std::optional<timestamp> get(const list& lst, size_t idx);
+    template <>
+    [[nodiscard]] std::optional<decimal128> get(const list& lst, size_t idx);
+
+    // Reads the elements in `[begin, end)` into `out`, replacing its contents, with a single
+    // call into the bridge rather than one per element. Core has no bulk read for lists, so
+    // the elements are read one at a time behind that call.
+    template <typename ValueType>
+    void get_range(const list&, size_t begin, size_t end, std::vector<ValueType>& out);
 }
 
 #endif //CPP_REALM_BRIDGE_LIST_HPP
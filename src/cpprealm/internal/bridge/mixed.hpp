@@ -3,7 +3,9 @@
 
 #include <string>
 #include <optional>
+#include <type_traits>
 #include <variant>
+#include <vector>
 #include <cpprealm/internal/bridge/property.hpp>
 #include <cpprealm/internal/bridge/binary.hpp>
 #include <cpprealm/internal/bridge/uuid.hpp>
@@ -11,6 +13,7 @@
 #include <cpprealm/internal/bridge/obj_key.hpp>
 #include <cpprealm/internal/bridge/object_id.hpp>
 #include <cpprealm/internal/bridge/decimal128.hpp>
+#include <cpprealm/internal/bridge/geospatial.hpp>
 
 namespace realm {
     class Mixed;
@@ -113,6 +116,40 @@ namespace realm::internal::bridge {
     bool operator <(const mixed&, const mixed&);
     bool operator >=(const mixed&, const mixed&);
     bool operator <=(const mixed&, const mixed&);
+
+    /**
+     An argument of a query string, either a single value or a list of values, which can
+     be used with `IN` and the other list comparisons, e.g. `_id IN $0`, or a region for
+     `GEOWITHIN`. As with `mixed`, string values refer to the caller's strings, which must
+     outlive the call.
+     */
+    struct query_argument {
+        template<typename T, std::enable_if_t<std::is_constructible_v<mixed, const T&> &&
+                                              !std::is_array_v<T> && !std::is_pointer_v<T>>* = nullptr>
+        query_argument(const T& value) : m_value(value) {} //NOLINT(google-explicit-constructor)
+        template<typename T, std::enable_if_t<std::is_constructible_v<mixed, const T&> &&
+                                              !std::is_same_v<T, uint8_t>>* = nullptr>
+        query_argument(const std::vector<T>& values) : m_is_list(true) { //NOLINT(google-explicit-constructor)
+            m_list.reserve(values.size());
+            for (const auto& v : values) {
+                m_list.emplace_back(v);
+            }
+        }
+
+        // A region for `GEOWITHIN`, e.g. `location GEOWITHIN $0`.
+        template<typename T, std::enable_if_t<std::is_convertible_v<const T&, geospatial>>* = nullptr>
+        query_argument(const T& shape) : m_shape(shape) {} //NOLINT(google-explicit-constructor)
+
+        [[nodiscard]] bool is_list() const noexcept { return m_is_list; }
+        [[nodiscard]] const mixed& value() const noexcept { return m_value; }
+        [[nodiscard]] const std::vector<mixed>& list() const noexcept { return m_list; }
+        [[nodiscard]] const std::optional<geospatial>& shape() const noexcept { return m_shape; }
+    private:
+        mixed m_value;
+        std::vector<mixed> m_list;
+        bool m_is_list = false;
+        std::optional<geospatial> m_shape;
+    };
 }
 
 
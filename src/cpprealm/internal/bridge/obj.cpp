@@ -17,6 +17,8 @@
 #include <realm/object-store/object_store.hpp>
 #include <realm/object-store/shared_realm.hpp>
 
+#include <cstring>
+
 namespace realm::internal::bridge {
     obj::obj() {
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
@@ -143,6 +145,9 @@ namespace realm::internal::bridge {
     obj obj::get_linked_object(const col_key &col_key) {
         return get_obj()->get_linked_object(col_key);
     }
+    obj_key obj::get_linked_key(const col_key &col_key) const {
+        return get_obj()->get<ObjKey>(col_key);
+    }
     bool obj::is_null(const col_key &col_key) const {
         return get_obj()->is_null(col_key);
     }
@@ -252,9 +257,8 @@ namespace realm::internal::bridge {
         get_obj()->set_list_values(col_key, v);
     }
     void obj::set_list_values(const col_key &col_key, const std::vector<bool>& values) {
-        if (values.empty())
-            return;
         auto list = get_obj()->get_list<bool>(col_key);
+        list.clear();
         for (size_t i = 0; i < values.size(); ++i) {
             list.add(values[i]);
         }
@@ -308,7 +312,8 @@ namespace realm::internal::bridge {
         get_obj()->set_list_values(col_key, v);
     }
     void obj::set_list_values(const col_key &col_key, const std::vector<mixed> &values) {
-       auto list = get_obj()->get_list<Mixed>(col_key);
+        auto list = get_obj()->get_list<Mixed>(col_key);
+        list.clear();
         auto size = values.size();
         for (size_t i = 0; i < size; ++i) {
             list.insert(i, values[i].operator Mixed());
@@ -326,6 +331,7 @@ namespace realm::internal::bridge {
     }
     void obj::set_list_values(const col_key &col_key, const std::vector<std::optional<std::string>> &values) {
         auto list = get_obj()->get_list<StringData>(col_key);
+        list.clear();
         auto size = values.size();
         for (size_t i = 0; i < size; ++i) {
             if (values[i]) {
@@ -337,6 +343,7 @@ namespace realm::internal::bridge {
     }
     void obj::set_list_values(const col_key &col_key, const std::vector<std::optional<obj_key>> &values) {
         auto list = get_obj()->get_list<ObjKey>(col_key);
+        list.clear();
         auto size = values.size();
         for (size_t i = 0; i < size; ++i) {
             if (values[i]) {
@@ -348,6 +355,7 @@ namespace realm::internal::bridge {
     }
     void obj::set_list_values(const col_key &col_key, const std::vector<std::optional<internal::bridge::uuid>> &values) {
         auto list = get_obj()->get_list<std::optional<UUID>>(col_key);
+        list.clear();
         auto size = values.size();
         for (size_t i = 0; i < size; ++i) {
             if (values[i]) {
@@ -359,6 +367,7 @@ namespace realm::internal::bridge {
     }
     void obj::set_list_values(const col_key &col_key, const std::vector<std::optional<internal::bridge::object_id>> &values) {
         auto list = get_obj()->get_list<std::optional<ObjectId>>(col_key);
+        list.clear();
         auto size = values.size();
         for (size_t i = 0; i < size; ++i) {
             if (values[i]) {
@@ -370,6 +379,7 @@ namespace realm::internal::bridge {
     }
     void obj::set_list_values(const col_key &col_key, const std::vector<std::optional<internal::bridge::binary>> &values) {
         auto list = get_obj()->get_list<Binary>(col_key);
+        list.clear();
         auto size = values.size();
         for (size_t i = 0; i < size; ++i) {
             if (values[i]) {
@@ -381,6 +391,7 @@ namespace realm::internal::bridge {
     }
     void obj::set_list_values(const col_key &col_key, const std::vector<std::optional<timestamp>> &values) {
         auto list = get_obj()->get_list<Timestamp>(col_key);
+        list.clear();
         auto size = values.size();
         for (size_t i = 0; i < size; ++i) {
             if (values[i]) {
@@ -391,6 +402,24 @@ namespace realm::internal::bridge {
         }
     }
 
+    void obj::resize_list(const col_key &col_key, size_t new_size) {
+        get_obj()->get_listbase_ptr(col_key)->resize(new_size);
+    }
+
+    size_t obj::get_binary_size(const col_key &col_key) const {
+        return get_obj()->get<BinaryData>(col_key).size();
+    }
+
+    size_t obj::read_binary(const col_key &col_key, size_t offset, uint8_t* dest, size_t count) const {
+        auto data = get_obj()->get<BinaryData>(col_key);
+        if (offset >= data.size()) {
+            return 0;
+        }
+        count = std::min(count, data.size() - offset);
+        std::memcpy(dest, data.data() + offset, count);
+        return count;
+    }
+
     void obj::set_null(const col_key &v) {
         get_obj()->set_null(v);
     }
@@ -408,6 +437,10 @@ namespace realm::internal::bridge {
     table_view obj::get_backlink_view(table table, col_key col_key) {
         return get_obj()->get_backlink_view(table, col_key);
     }
+
+    size_t obj::get_backlink_count(const table& origin, const col_key& origin_col_key) const {
+        return get_obj()->get_backlink_count(*static_cast<TableRef>(origin), origin_col_key);
+    }
 }
 
 std::string realm::internal::bridge::table_name_for_object_type(const std::string &v) {
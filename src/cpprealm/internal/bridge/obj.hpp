@@ -121,6 +121,8 @@ namespace realm::internal::bridge {
         [[nodiscard]] bool is_null(const col_key& col_key) const;
         [[nodiscard]] bool is_valid() const;
         obj get_linked_object(const col_key& col_key);
+        // The key of the object a link property points to, without creating an accessor for it.
+        [[nodiscard]] obj_key get_linked_key(const col_key& col_key) const;
         template <typename T>
         T get(const col_key& col_key) const {
             if constexpr (is_optional<T>::value) {
@@ -215,6 +217,14 @@ namespace realm::internal::bridge {
             set_list_values(col_key, v2);
         }
 
+        // Grows the list with default values or truncates it to `new_size` elements.
+        void resize_list(const col_key& col_key, size_t new_size);
+
+        // Reads part of a binary value in place, without copying the rest of it.
+        // Returns the number of bytes copied into `dest`.
+        [[nodiscard]] size_t get_binary_size(const col_key& col_key) const;
+        size_t read_binary(const col_key& col_key, size_t offset, uint8_t* dest, size_t count) const;
+
         [[nodiscard]] obj_key get_key() const;
         [[nodiscard]] obj_link get_link() const;
         lnklst get_linklist(const col_key& col_key);
@@ -222,6 +232,7 @@ namespace realm::internal::bridge {
         void set_null(const col_key&);
         obj create_and_set_linked_object(const col_key&);
         table_view get_backlink_view(table, col_key);
+        [[nodiscard]] size_t get_backlink_count(const table& origin, const col_key& origin_col_key) const;
 
     private:
         inline const Obj* get_obj() const;
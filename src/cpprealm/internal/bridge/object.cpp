@@ -8,6 +8,7 @@
 #include <cpprealm/internal/bridge/realm.hpp>
 
 #include <realm/object-store/dictionary.hpp>
+#include <realm/object-store/impl/collection_change_builder.hpp>
 #include <realm/object-store/list.hpp>
 #include <realm/object-store/object.hpp>
 
@@ -126,10 +127,10 @@ namespace realm::internal::bridge {
         return *m_object;
 #endif
     }
-    notification_token object::add_notification_callback(std::shared_ptr<collection_change_callback>&& cb) {
-        struct wrapper : CollectionChangeCallback {
+    namespace {
+        struct callback_wrapper : CollectionChangeCallback {
             std::shared_ptr<collection_change_callback> m_cb;
-            explicit wrapper(std::shared_ptr<collection_change_callback>&& cb)
+            explicit callback_wrapper(std::shared_ptr<collection_change_callback>&& cb)
                 : m_cb(std::move(cb)) {}
             void before(const CollectionChangeSet& v) const {
                 m_cb->before(v);
@@ -137,7 +138,11 @@ namespace realm::internal::bridge {
             void after(const CollectionChangeSet& v) const {
                 m_cb->after(v);
             }
-        } ccb(std::move(cb));
+        };
+    }
+
+    notification_token object::add_notification_callback(std::shared_ptr<collection_change_callback>&& cb) {
+        callback_wrapper ccb(std::move(cb));
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         return reinterpret_cast<Object*>(&m_object)->add_notification_callback(ccb);
 #else
@@ -145,6 +150,23 @@ namespace realm::internal::bridge {
 #endif
     }
 
+    notification_token object::add_notification_callback(std::shared_ptr<collection_change_callback>&& cb,
+                                                         const key_path_array& key_paths) {
+        callback_wrapper ccb(std::move(cb));
+        KeyPathArray core_key_paths;
+        for (auto& path : key_paths) {
+            KeyPath& core_path = core_key_paths.emplace_back();
+            for (auto& [table_key, col_key] : path) {
+                core_path.emplace_back(TableKey(table_key), ColKey(col_key));
+            }
+        }
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        return reinterpret_cast<Object*>(&m_object)->add_notification_callback(ccb, std::move(core_key_paths));
+#else
+        return m_object->add_notification_callback(ccb, std::move(core_key_paths));
+#endif
+    }
+
     bool index_set::empty() const {
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         return reinterpret_cast<const IndexSet*>(&m_idx_set)->empty();
@@ -233,6 +255,14 @@ namespace realm::internal::bridge {
 #endif
     }
 
+    index_set collection_change_set::modifications_new() const {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        return reinterpret_cast<const CollectionChangeSet *>(&m_change_set)->modifications_new;
+#else
+        return m_change_set->modifications_new;
+#endif
+    }
+
     std::unordered_map<int64_t, index_set> collection_change_set::columns() const {
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         auto& columns = reinterpret_cast<const CollectionChangeSet *>(&m_change_set)->columns;
@@ -246,6 +276,16 @@ namespace realm::internal::bridge {
         return map;
     }
 
+    bool collection_change_set::is_column_modified(int64_t col_key) const {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        auto& columns = reinterpret_cast<const CollectionChangeSet *>(&m_change_set)->columns;
+#else
+        auto& columns = m_change_set->columns;
+#endif
+        auto it = columns.find(col_key);
+        return it != columns.end() && !it->second.empty();
+    }
+
     index_set collection_change_set::deletions() const {
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         return reinterpret_cast<const CollectionChangeSet *>(&m_change_set)->deletions;
@@ -520,6 +560,150 @@ namespace realm::internal::bridge {
         return iter;
     }
 
+    std::vector<index_range> index_set::as_ranges() const {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        auto& set = *reinterpret_cast<const IndexSet*>(&m_idx_set);
+#else
+        auto& set = *m_idx_set;
+#endif
+        std::vector<index_range> ranges;
+        for (auto& [begin, end] : set) {
+            ranges.push_back({begin, end});
+        }
+        return ranges;
+    }
+
+    index_set::range_view index_set::ranges() const {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        return range_view(reinterpret_cast<const IndexSet*>(&m_idx_set));
+#else
+        return range_view(m_idx_set.get());
+#endif
+    }
+
+    index_set::range_view collection_change_set::deletion_ranges() const {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        return index_set::range_view(&reinterpret_cast<const CollectionChangeSet*>(&m_change_set)->deletions);
+#else
+        return index_set::range_view(&m_change_set->deletions);
+#endif
+    }
+
+    index_set::range_view collection_change_set::modification_ranges() const {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        return index_set::range_view(&reinterpret_cast<const CollectionChangeSet*>(&m_change_set)->modifications);
+#else
+        return index_set::range_view(&m_change_set->modifications);
+#endif
+    }
+
+    index_set::range_view collection_change_set::insertion_ranges() const {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        return index_set::range_view(&reinterpret_cast<const CollectionChangeSet*>(&m_change_set)->insertions);
+#else
+        return index_set::range_view(&m_change_set->insertions);
+#endif
+    }
+
+    namespace {
+        // Backs views which were default constructed, e.g. for the initial notification.
+        const IndexSet& empty_index_set() {
+            static const IndexSet set;
+            return set;
+        }
+    }
+
+    index_set::range_iterator index_set::range_view::begin() const noexcept {
+        return range_iterator(m_set ? *m_set : empty_index_set(), false);
+    }
+
+    index_set::range_iterator index_set::range_view::end() const noexcept {
+        return range_iterator(m_set ? *m_set : empty_index_set(), true);
+    }
+
+    bool index_set::range_view::empty() const noexcept {
+        return !m_set || m_set->empty();
+    }
+
+    size_t index_set::range_view::count() const noexcept {
+        return m_set ? m_set->count() : 0;
+    }
+
+#ifndef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+    static_assert(sizeof(IndexSet::const_iterator) <= sizeof(index_set::range_iterator) &&
+                  alignof(IndexSet::const_iterator) <= alignof(index_set::range_iterator),
+                  "index_set::range_iterator is too small to hold an IndexSet::const_iterator");
+#endif
+
+    index_set::range_iterator::range_iterator(const IndexSet& set, bool end) {
+        new (&m_iterator) IndexSet::const_iterator(end ? set.end() : set.begin());
+    }
+
+    index_set::range_iterator::range_iterator(const index_set::range_iterator& other) {
+        new (&m_iterator) IndexSet::const_iterator(*reinterpret_cast<const IndexSet::const_iterator*>(&other.m_iterator));
+    }
+
+    index_set::range_iterator& index_set::range_iterator::operator=(const index_set::range_iterator& other) {
+        if (this != &other) {
+            *reinterpret_cast<IndexSet::const_iterator*>(&m_iterator) = *reinterpret_cast<const IndexSet::const_iterator*>(&other.m_iterator);
+        }
+        return *this;
+    }
+
+    index_set::range_iterator::range_iterator(index_set::range_iterator&& other) {
+        new (&m_iterator) IndexSet::const_iterator(std::move(*reinterpret_cast<IndexSet::const_iterator*>(&other.m_iterator)));
+    }
+
+    index_set::range_iterator& index_set::range_iterator::operator=(index_set::range_iterator&& other) {
+        if (this != &other) {
+            *reinterpret_cast<IndexSet::const_iterator*>(&m_iterator) = std::move(*reinterpret_cast<IndexSet::const_iterator*>(&other.m_iterator));
+        }
+        return *this;
+    }
+
+    index_set::range_iterator::~range_iterator() {
+        reinterpret_cast<IndexSet::const_iterator*>(&m_iterator)->~const_iterator();
+    }
+
+    index_range index_set::range_iterator::operator*() const noexcept {
+        auto& range = **reinterpret_cast<const IndexSet::const_iterator*>(&m_iterator);
+        return {range.first, range.second};
+    }
+
+    bool index_set::range_iterator::operator==(const index_set::range_iterator& it) const noexcept {
+        return *reinterpret_cast<const IndexSet::const_iterator*>(&m_iterator) ==
+               *reinterpret_cast<const IndexSet::const_iterator*>(&it.m_iterator);
+    }
+
+    bool index_set::range_iterator::operator!=(const index_set::range_iterator& it) const noexcept {
+        return !(*this == it);
+    }
+
+    index_set::range_iterator& index_set::range_iterator::operator++() noexcept {
+        ++*reinterpret_cast<IndexSet::const_iterator*>(&m_iterator);
+        return *this;
+    }
+
+    void collection_change_set::merge(const collection_change_set& later) {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        auto& cs = *reinterpret_cast<CollectionChangeSet*>(&m_change_set);
+        auto& other = *reinterpret_cast<const CollectionChangeSet*>(&later.m_change_set);
+#else
+        auto& cs = *m_change_set;
+        auto& other = *later.m_change_set;
+#endif
+        // The builders track modifications by their index after the change, which
+        // `finalize()` maps back to `modifications` and returns as `modifications_new`.
+        _impl::CollectionChangeBuilder builder(cs.deletions, cs.insertions, cs.modifications_new, cs.moves,
+                                               cs.collection_root_was_deleted);
+        builder.columns = cs.columns;
+        _impl::CollectionChangeBuilder next(other.deletions, other.insertions, other.modifications_new, other.moves,
+                                            other.collection_root_was_deleted);
+        next.columns = other.columns;
+        builder.merge(std::move(next));
+        cs = std::move(builder).finalize();
+    }
+
     index_set::index_iterable_adaptor index_set::as_indexes() const {
         index_iterable_adaptor iter;
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
@@ -3,8 +3,10 @@
 
 #include <any>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <cpprealm/internal/bridge/utils.hpp>
 
@@ -42,6 +44,22 @@ namespace realm::internal::bridge {
 #endif
     };
 
+    // A property reached through a chain of (table key, column key) pairs.
+    using key_path = std::vector<std::pair<uint32_t, int64_t>>;
+    // Restricts notifications to changes on the given key paths.
+    using key_path_array = std::vector<key_path>;
+
+    // A half-open `[begin, end)` range of indices.
+    struct index_range {
+        size_t begin;
+        size_t end;
+
+        [[nodiscard]] size_t size() const noexcept { return end - begin; }
+        bool operator==(const index_range& other) const noexcept {
+            return begin == other.begin && end == other.end;
+        }
+    };
+
     struct index_set {
         index_set(); //NOLINT(google-explicit-constructor)
         index_set(const index_set& other) ;
@@ -98,6 +116,56 @@ namespace realm::internal::bridge {
 #endif
         };
         index_iterable_adaptor as_indexes() const;
+        // The contiguous ranges making up this set, in ascending order.
+        [[nodiscard]] std::vector<index_range> as_ranges() const;
+
+        // An iterator over the contiguous ranges in the set.
+        class range_iterator {
+        public:
+            using difference_type = std::ptrdiff_t;
+            using value_type = index_range;
+            using pointer = void;
+            using reference = index_range;
+            using iterator_category = std::input_iterator_tag;
+
+            range_iterator(const range_iterator& other);
+            range_iterator& operator=(const range_iterator& other);
+            range_iterator(range_iterator&& other);
+            range_iterator& operator=(range_iterator&& other);
+            ~range_iterator();
+            index_range operator*() const noexcept;
+            bool operator==(range_iterator const& it) const noexcept;
+            bool operator!=(range_iterator const& it) const noexcept;
+
+            range_iterator& operator++() noexcept;
+        private:
+            range_iterator(const IndexSet& set, bool end);
+            friend struct range_view;
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+            storage::IndexSet_ConstIterator m_iterator[1];
+#else
+            // Holds the IndexSet::const_iterator in place, so iterating does not allocate.
+            // Its size is checked in object.cpp.
+            alignas(void*) unsigned char m_iterator[4 * sizeof(void*)];
+#endif
+        };
+
+        // A non-owning view of the ranges of an index set. It does not copy the set,
+        // so it is only valid for as long as the set it was created from.
+        struct range_view {
+            range_view() = default;
+            explicit range_view(const IndexSet* set) : m_set(set) {}
+
+            [[nodiscard]] range_iterator begin() const noexcept;
+            [[nodiscard]] range_iterator end() const noexcept;
+            [[nodiscard]] bool empty() const noexcept;
+            // The number of indices in all ranges.
+            [[nodiscard]] size_t count() const noexcept;
+        private:
+            const IndexSet* m_set = nullptr;
+        };
+        // A view of the ranges in this set which is valid for the lifetime of this set.
+        [[nodiscard]] range_view ranges() const;
     private:
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         storage::IndexSet m_idx_set[1];
@@ -116,10 +184,22 @@ namespace realm::internal::bridge {
         operator CollectionChangeSet() const;
         [[nodiscard]] index_set deletions() const;
         [[nodiscard]] index_set modifications() const;
+        // The modified indices in the collection after the change, where `modifications()`
+        // refers to the collection before it.
+        [[nodiscard]] index_set modifications_new() const;
         [[nodiscard]] index_set insertions() const;
         [[nodiscard]] std::unordered_map<int64_t, index_set> columns() const;
+        // Views of the index sets above which reference this change set instead of copying it.
+        [[nodiscard]] index_set::range_view deletion_ranges() const;
+        [[nodiscard]] index_set::range_view modification_ranges() const;
+        [[nodiscard]] index_set::range_view insertion_ranges() const;
+        // Whether the column with the given key was modified, without copying `columns()`.
+        [[nodiscard]] bool is_column_modified(int64_t col_key) const;
         [[nodiscard]] bool empty() const;
         [[nodiscard]] bool collection_root_was_deleted() const;
+        // Fold a change set which was computed after this one into it, so that the
+        // result describes both changes relative to the state before this one.
+        void merge(const collection_change_set& later);
     private:
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         storage::CollectionChangeSet m_change_set[1];
@@ -152,6 +232,8 @@ namespace realm::internal::bridge {
         [[nodiscard]] bool is_valid() const;
 
         notification_token add_notification_callback(std::shared_ptr<collection_change_callback>&& cb);
+        notification_token add_notification_callback(std::shared_ptr<collection_change_callback>&& cb,
+                                                     const key_path_array& key_paths);
 
         [[nodiscard]] object_schema get_object_schema() const;
 
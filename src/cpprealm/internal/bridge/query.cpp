@@ -1,8 +1,10 @@
 #include <cpprealm/internal/bridge/query.hpp>
+#include <cpprealm/query_cache.hpp>
 
 #include <cpprealm/internal/bridge/binary.hpp>
 #include <cpprealm/internal/bridge/col_key.hpp>
 #include <cpprealm/internal/bridge/decimal128.hpp>
+#include <cpprealm/internal/bridge/geospatial.hpp>
 #include <cpprealm/internal/bridge/mixed.hpp>
 #include <cpprealm/internal/bridge/object_id.hpp>
 #include <cpprealm/internal/bridge/table.hpp>
@@ -10,16 +12,36 @@
 #include <cpprealm/internal/bridge/uuid.hpp>
 
 #include <realm/query.hpp>
+#include <realm/query_expression.hpp>
+#include <realm/table.hpp>
+#if REALM_ENABLE_GEOSPATIAL
+#include <realm/geospatial.hpp>
+#endif
+
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <variant>
 
 #define __generate_query_operator(op, type) \
     query &query::op(col_key column_key, type value) { \
+        bool unconditional = is_unconditional(); \
         this->operator=(get_query()->op(column_key, value)); \
+        if (unconditional) { \
+            m_shape = comparison_shape(column_key, query_shape::comparison_kind::op, value); \
+        } \
         return *this; \
     }
 
 #define __generate_query_operator_case_sensitive(op, type) \
     query &query::op(col_key column_key, type value, bool) { \
+        bool unconditional = is_unconditional(); \
         this->operator=(get_query()->op(column_key, value)); \
+        if (unconditional) { \
+            m_shape = comparison_shape(column_key, query_shape::comparison_kind::op, value); \
+        } \
         return *this; \
     }
 
@@ -29,6 +51,122 @@
         return *this; \
     }
 namespace realm::internal::bridge {
+    struct query_shape {
+        enum class kind { unconditional, comparison, conjunction, disjunction };
+        enum class comparison_kind { equal, not_equal, greater, greater_equal, less, less_equal, contains, in };
+
+        kind shape_kind = kind::unconditional;
+        // Set for comparisons.
+        col_key column;
+        comparison_kind comparison = comparison_kind::equal;
+        std::variant<int64_t, double, std::string> value;
+        // Set for conjunctions and disjunctions.
+        std::vector<query> operands;
+
+        static const query_shape* of(const query& q) {
+            return q.m_shape.get();
+        }
+
+        static void set(query& q, std::shared_ptr<const query_shape> shape) {
+            q.m_shape = std::move(shape);
+        }
+
+        static std::shared_ptr<const query_shape> unconditional() {
+            static auto shape = std::make_shared<const query_shape>();
+            return shape;
+        }
+
+        static std::shared_ptr<const query_shape> combined(kind k, std::vector<query>&& operands) {
+            auto shape = std::make_shared<query_shape>();
+            shape->shape_kind = k;
+            shape->operands = std::move(operands);
+            return shape;
+        }
+
+        // Adds the operands of `q` if it is a combination of kind `k`, otherwise `q` itself.
+        static void append_operands(std::vector<query>& operands, const query& q, kind k) {
+            auto shape = of(q);
+            if (shape && shape->shape_kind == k) {
+                operands.insert(operands.end(), shape->operands.begin(), shape->operands.end());
+            } else {
+                operands.push_back(q);
+            }
+        }
+
+        bool is_comparison(comparison_kind c) const {
+            return shape_kind == kind::comparison && comparison == c;
+        }
+
+        // The inclusive lower bound this comparison sets on an integer or floating point column.
+        std::optional<std::variant<int64_t, double, std::string>> lower_bound() const {
+            if (shape_kind != kind::comparison || std::holds_alternative<std::string>(value)) {
+                return std::nullopt;
+            }
+            if (comparison == comparison_kind::greater_equal) {
+                return value;
+            }
+            if (comparison == comparison_kind::greater && std::holds_alternative<int64_t>(value) &&
+                std::get<int64_t>(value) < std::numeric_limits<int64_t>::max()) {
+                return std::get<int64_t>(value) + 1;
+            }
+            return std::nullopt;
+        }
+
+        // The inclusive upper bound this comparison sets on an integer or floating point column.
+        std::optional<std::variant<int64_t, double, std::string>> upper_bound() const {
+            if (shape_kind != kind::comparison || std::holds_alternative<std::string>(value)) {
+                return std::nullopt;
+            }
+            if (comparison == comparison_kind::less_equal) {
+                return value;
+            }
+            if (comparison == comparison_kind::less && std::holds_alternative<int64_t>(value) &&
+                std::get<int64_t>(value) > std::numeric_limits<int64_t>::min()) {
+                return std::get<int64_t>(value) - 1;
+            }
+            return std::nullopt;
+        }
+
+        Mixed value_as_mixed() const {
+            return std::visit([](auto& v) {
+                if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::string>) {
+                    return Mixed(StringData(v));
+                } else {
+                    return Mixed(v);
+                }
+            }, value);
+        }
+    };
+
+    namespace {
+        template <typename T>
+        std::shared_ptr<const query_shape> comparison_shape(const col_key&, query_shape::comparison_kind, const T&) {
+            return nullptr;
+        }
+
+        std::shared_ptr<const query_shape> comparison_shape(const col_key& column, query_shape::comparison_kind comparison,
+                                                            std::variant<int64_t, double, std::string>&& value) {
+            auto shape = std::make_shared<query_shape>();
+            shape->shape_kind = query_shape::kind::comparison;
+            shape->column = column;
+            shape->comparison = comparison;
+            shape->value = std::move(value);
+            return shape;
+        }
+
+        std::shared_ptr<const query_shape> comparison_shape(const col_key& column, query_shape::comparison_kind comparison, int64_t value) {
+            return comparison_shape(column, comparison, std::variant<int64_t, double, std::string>(value));
+        }
+
+        std::shared_ptr<const query_shape> comparison_shape(const col_key& column, query_shape::comparison_kind comparison, double value) {
+            return comparison_shape(column, comparison, std::variant<int64_t, double, std::string>(value));
+        }
+
+        std::shared_ptr<const query_shape> comparison_shape(const col_key& column, query_shape::comparison_kind comparison, std::string_view value) {
+            return comparison_shape(column, comparison, std::variant<int64_t, double, std::string>(std::string(value)));
+        }
+    }
+
     query::query() {
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         new (&m_query) Query();
@@ -43,6 +181,7 @@ namespace realm::internal::bridge {
 #else
         m_query = other.m_query;
 #endif
+        m_shape = other.m_shape;
     }
 
     query& query::operator=(const query& other) {
@@ -53,6 +192,7 @@ namespace realm::internal::bridge {
 #else
         m_query = other.m_query;
 #endif
+        m_shape = other.m_shape;
         return *this;
     }
 
@@ -62,6 +202,7 @@ namespace realm::internal::bridge {
 #else
         m_query = std::move(other.m_query);
 #endif
+        m_shape = std::move(other.m_shape);
     }
 
     query& query::operator=(query&& other) {
@@ -72,6 +213,7 @@ namespace realm::internal::bridge {
 #else
         m_query = std::move(other.m_query);
 #endif
+        m_shape = std::move(other.m_shape);
         return *this;
     }
 
@@ -95,6 +237,7 @@ namespace realm::internal::bridge {
 #else
         m_query = std::make_shared<Query>(table.operator ConstTableRef());
 #endif
+        m_shape = query_shape::unconditional();
     }
 
     query::query(const Query &v) {
@@ -112,6 +255,10 @@ namespace realm::internal::bridge {
         return *m_query;
 #endif
     }
+    bool query::is_unconditional() const {
+        return m_shape && m_shape->shape_kind == query_shape::kind::unconditional;
+    }
+
     table query::get_table() {
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         return reinterpret_cast<Query*>(&m_query)->get_table();
@@ -120,6 +267,7 @@ namespace realm::internal::bridge {
 #endif
     }
     query query::and_query(const query &v) {
+        m_shape.reset();
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         return reinterpret_cast<Query*>(&m_query)->and_query(v);
 #else
@@ -178,6 +326,7 @@ namespace realm::internal::bridge {
 #else
         m_query = std::make_shared<Query>(m_query->equal(column_key, realm::null{}));
 #endif
+        m_shape.reset();
         return *this;
     }
     query& query::not_equal(col_key column_key, std::nullopt_t) {
@@ -186,6 +335,7 @@ namespace realm::internal::bridge {
 #else
         m_query = std::make_shared<Query>(m_query->not_equal(column_key, realm::null{}));
 #endif
+        m_shape.reset();
         return *this;
     }
 
@@ -195,6 +345,7 @@ namespace realm::internal::bridge {
 #else
         m_query = std::make_shared<Query>(m_query->operator!());
 #endif
+        m_shape.reset();
         return *this;
     }
 
@@ -208,7 +359,233 @@ namespace realm::internal::bridge {
     __generate_query_operator_case_sensitive(equal, binary)
     __generate_query_operator_case_sensitive(not_equal, binary)
 
+    query& query::between(col_key column_key, int64_t from, int64_t to) {
+        this->operator=(get_query()->between(column_key, from, to));
+        return *this;
+    }
+
+    query& query::between(col_key column_key, double from, double to) {
+        this->operator=(get_query()->between(column_key, from, to));
+        return *this;
+    }
+
+    query& query::in(col_key column_key, const std::vector<mixed>& values) {
+        std::vector<Mixed> v;
+        v.reserve(values.size());
+        for (auto& value : values) {
+            v.push_back(value.operator ::realm::Mixed());
+        }
+        bool unconditional = is_unconditional();
+        this->operator=(get_query()->in(column_key, v.data(), v.data() + v.size()));
+        if (unconditional) {
+            auto shape = std::make_shared<query_shape>();
+            shape->shape_kind = query_shape::kind::comparison;
+            shape->column = column_key;
+            shape->comparison = query_shape::comparison_kind::in;
+            m_shape = std::move(shape);
+        }
+        return *this;
+    }
+
+    std::optional<col_key> query::indexed_column() const {
+        using kind = query_shape::kind;
+        auto table = const_cast<query*>(this)->get_query()->get_table();
+        std::function<std::optional<col_key>(const query&)> find = [&](const query& q) -> std::optional<col_key> {
+            auto shape = query_shape::of(q);
+            if (!shape) {
+                return std::nullopt;
+            }
+            switch (shape->shape_kind) {
+                case kind::comparison:
+                    if ((shape->is_comparison(query_shape::comparison_kind::equal) ||
+                         shape->is_comparison(query_shape::comparison_kind::in)) &&
+                        table->has_search_index(shape->column)) {
+                        return shape->column;
+                    }
+                    return std::nullopt;
+                case kind::conjunction:
+                    // Core evaluates the cheapest condition first, which is an index lookup if there is one.
+                    for (auto& operand : shape->operands) {
+                        if (auto column = find(operand)) {
+                            return column;
+                        }
+                    }
+                    return std::nullopt;
+                case kind::disjunction: {
+                    // Each alternative is looked up separately, so all of them must use the index.
+                    std::optional<col_key> column;
+                    for (auto& operand : shape->operands) {
+                        auto c = find(operand);
+                        if (!c || (column && column->value() != c->value())) {
+                            return std::nullopt;
+                        }
+                        column = c;
+                    }
+                    return column;
+                }
+                default:
+                    return std::nullopt;
+            }
+        };
+        return find(*this);
+    }
+
+    query& query::collection_comparison(col_key column_key, collection_operand operand, comparison op,
+                                        const mixed& value, const std::string& dictionary_key) {
+        // Collection conditions are lowered through the query language, whose ANY/ALL/NONE
+        // quantifiers and @count, @sum, @min, @max, @avg and @keys operators map directly
+        // onto core's collection expressions. The parsed query is cached per expression.
+        std::string column(get_query()->get_table()->get_column_name(column_key));
+        std::string expression;
+        switch (operand) {
+            case collection_operand::any: expression = "ANY " + column; break;
+            case collection_operand::all: expression = "ALL " + column; break;
+            case collection_operand::none: expression = "NONE " + column; break;
+            case collection_operand::count: expression = column + ".@count"; break;
+            case collection_operand::sum: expression = column + ".@sum"; break;
+            case collection_operand::min: expression = column + ".@min"; break;
+            case collection_operand::max: expression = column + ".@max"; break;
+            case collection_operand::avg: expression = column + ".@avg"; break;
+            case collection_operand::keys: expression = column + ".@keys"; break;
+            case collection_operand::entry: {
+                expression = column + "['";
+                for (char c : dictionary_key) {
+                    if (c == '\\' || c == '\'') {
+                        expression += '\\';
+                    }
+                    expression += c;
+                }
+                expression += "']";
+                break;
+            }
+        }
+        switch (op) {
+            case comparison::equal: expression += " == $0"; break;
+            case comparison::not_equal: expression += " != $0"; break;
+            case comparison::greater: expression += " > $0"; break;
+            case comparison::greater_equal: expression += " >= $0"; break;
+            case comparison::less: expression += " < $0"; break;
+            case comparison::less_equal: expression += " <= $0"; break;
+        }
+        this->operator=(and_query(parse_query(get_table(), expression, std::vector<mixed>{value})));
+        return *this;
+    }
+
+    query& query::geo_within(col_key column_key, const geospatial& bounds) {
+#if REALM_ENABLE_GEOSPATIAL
+        auto table = get_query()->get_table();
+        this->operator=(and_query(table->column<Link>(column_key).geo_within(bounds)));
+        return *this;
+#else
+        throw std::runtime_error("Geospatial queries are not supported by this build of Realm Core.");
+#endif
+    }
+
+    query operator&&(query const& lhs, query const& rhs) {
+        using kind = query_shape::kind;
+        auto lhs_shape = query_shape::of(lhs);
+        auto rhs_shape = query_shape::of(rhs);
+        if (lhs_shape && lhs_shape->shape_kind == kind::unconditional) {
+            return rhs;
+        }
+        if (rhs_shape && rhs_shape->shape_kind == kind::unconditional) {
+            return lhs;
+        }
+
+        std::vector<query> operands;
+        query_shape::append_operands(operands, lhs, kind::conjunction);
+        query_shape::append_operands(operands, rhs, kind::conjunction);
+
+        // Pair up inclusive lower and upper bounds on the same column.
+        std::vector<bool> merged(operands.size());
+        std::vector<std::tuple<col_key, std::variant<int64_t, double, std::string>, std::variant<int64_t, double, std::string>>> ranges;
+        for (size_t i = 0; i < operands.size(); i++) {
+            auto lower_shape = query_shape::of(operands[i]);
+            auto lower = lower_shape ? lower_shape->lower_bound() : std::nullopt;
+            if (merged[i] || !lower) {
+                continue;
+            }
+            for (size_t j = 0; j < operands.size(); j++) {
+                auto upper_shape = query_shape::of(operands[j]);
+                auto upper = upper_shape ? upper_shape->upper_bound() : std::nullopt;
+                if (merged[j] || i == j || !upper || upper_shape->column.value() != lower_shape->column.value() ||
+                    upper->index() != lower->index()) {
+                    continue;
+                }
+                ranges.emplace_back(lower_shape->column, std::move(*lower), std::move(*upper));
+                merged[i] = merged[j] = true;
+                break;
+            }
+        }
+
+        Query q;
+        if (ranges.empty()) {
+            q = static_cast<Query>(lhs);
+            q.and_query(static_cast<Query>(rhs));
+        } else {
+            q = Query(static_cast<Query>(lhs).get_table());
+            for (size_t i = 0; i < operands.size(); i++) {
+                if (!merged[i]) {
+                    q.and_query(static_cast<Query>(operands[i]));
+                }
+            }
+            for (auto& [column, from, to] : ranges) {
+                if (std::holds_alternative<int64_t>(from)) {
+                    q.between(column, std::get<int64_t>(from), std::get<int64_t>(to));
+                } else {
+                    q.between(column, std::get<double>(from), std::get<double>(to));
+                }
+            }
+        }
+        query result(q);
+        query_shape::set(result, query_shape::combined(kind::conjunction, std::move(operands)));
+        return result;
+    }
+
     query operator||(query const& lhs, query const& rhs) {
-        return static_cast<Query>(lhs) || static_cast<Query>(rhs);
+        using kind = query_shape::kind;
+        auto lhs_shape = query_shape::of(lhs);
+        auto rhs_shape = query_shape::of(rhs);
+        if (lhs_shape && lhs_shape->shape_kind == kind::unconditional) {
+            return lhs;
+        }
+        if (rhs_shape && rhs_shape->shape_kind == kind::unconditional) {
+            return rhs;
+        }
+
+        std::vector<query> operands;
+        query_shape::append_operands(operands, lhs, kind::disjunction);
+        query_shape::append_operands(operands, rhs, kind::disjunction);
+
+        // A disjunction of equalities on one column is a lookup in a set of values.
+        auto first = query_shape::of(operands.front());
+        bool is_in = first && first->is_comparison(query_shape::comparison_kind::equal);
+        for (size_t i = 1; is_in && i < operands.size(); i++) {
+            auto shape = query_shape::of(operands[i]);
+            is_in = shape && shape->is_comparison(query_shape::comparison_kind::equal) &&
+                    shape->column.value() == first->column.value() && shape->value.index() == first->value.index();
+        }
+
+        Query q(static_cast<Query>(lhs).get_table());
+        if (is_in) {
+            std::vector<Mixed> values;
+            values.reserve(operands.size());
+            for (auto& operand : operands) {
+                values.push_back(query_shape::of(operand)->value_as_mixed());
+            }
+            q.in(first->column, values.data(), values.data() + values.size());
+        } else {
+            q.group();
+            for (size_t i = 0; i < operands.size(); i++) {
+                if (i > 0) {
+                    q.Or();
+                }
+                q.and_query(static_cast<Query>(operands[i]));
+            }
+            q.end_group();
+        }
+        query result(q);
+        query_shape::set(result, query_shape::combined(kind::disjunction, std::move(operands)));
+        return result;
     }
 }
@@ -4,8 +4,11 @@
 #include <cpprealm/internal/bridge/col_key.hpp>
 #include <cpprealm/internal/bridge/utils.hpp>
 
+#include <memory>
 #include <optional>
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace realm {
     struct object_id;
@@ -22,7 +25,9 @@ namespace realm::internal::bridge {
     struct decimal128;
     struct uuid;
     struct mixed;
-
+    struct geospatial;
+    // How a query was composed, see `operator&&` and `operator||`.
+    struct query_shape;
 
     struct query {
         query();
@@ -123,15 +128,47 @@ namespace realm::internal::bridge {
         // Conditions: bool
         query& equal(col_key column_key, bool value);
         query& not_equal(col_key column_key, bool value);
+
+        // Conditions: the value is one of `values`
+        query& in(col_key column_key, const std::vector<mixed>& values);
+
+        // Conditions: collections
+        enum class collection_operand {
+            // Quantifiers over the elements of a list or set, or the values of a dictionary.
+            any, all, none,
+            // The size of the collection and aggregates of its values.
+            count, sum, min, max, avg,
+            // The keys of a dictionary, any of which may match.
+            keys,
+            // The value for a single key of a dictionary.
+            entry
+        };
+        enum class comparison { equal, not_equal, greater, greater_equal, less, less_equal };
+        query& collection_comparison(col_key column_key, collection_operand operand, comparison op,
+                                     const mixed& value, const std::string& dictionary_key = {});
+
+        // Conditions: the embedded point in the link column lies within `bounds`
+        query& geo_within(col_key column_key, const geospatial& bounds);
+
+        // The column whose search index core looks up to find candidate objects: an indexed
+        // column compared for equality by a condition which must hold. Only known for queries
+        // built from conditions, not query strings.
+        [[nodiscard]] std::optional<col_key> indexed_column() const;
+
         using underlying = Query;
     private:
         inline Query* get_query();
+        bool is_unconditional() const;
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         storage::Query m_query[1];
 #else
         std::shared_ptr<Query> m_query;
 #endif
+        // Set for queries built with a single condition or by combining queries, null once
+        // the query has been changed in a way which is not tracked.
+        std::shared_ptr<const query_shape> m_shape;
 
+        friend struct query_shape;
     };
 
     template <typename T>
@@ -139,6 +176,12 @@ namespace realm::internal::bridge {
     template <typename T>
     using QFnCS = query& (query::*)(col_key, T, bool);
 
+    /**
+     Combines two queries. Nested conjunctions and disjunctions are flattened into one
+     group, an inclusive lower and upper bound on the same integer or floating point column
+     become a single `between`, and a disjunction of equalities on one column becomes `in`.
+     */
+    query operator && (const query& lhs, const query& rhs);
     query operator || (const query& lhs, const query& rhs);
 }
 
@@ -56,6 +56,18 @@ namespace realm::internal::bridge {
         m_realm->commit_transaction();
     }
 
+    void realm::cancel_transaction() const {
+        m_realm->cancel_transaction();
+    }
+
+    void realm::async_begin_transaction(std::function<void()> &&fn) const {
+        m_realm->async_begin_transaction(std::move(fn));
+    }
+
+    void realm::async_commit_transaction(std::function<void(std::exception_ptr)> &&fn) const {
+        m_realm->async_commit_transaction(std::move(fn));
+    }
+
     struct internal_scheduler : util::Scheduler {
         internal_scheduler(const std::shared_ptr<scheduler>& s)
         : m_scheduler(s)
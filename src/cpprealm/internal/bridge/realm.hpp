@@ -1,6 +1,7 @@
 #ifndef CPP_REALM_BRIDGE_REALM_HPP
 #define CPP_REALM_BRIDGE_REALM_HPP
 
+#include <exception>
 #include <functional>
 #include <map>
 #include <memory>
@@ -188,6 +189,13 @@ namespace realm::internal::bridge {
         [[nodiscard]] struct schema schema() const;
         void begin_transaction() const;
         void commit_transaction() const;
+        void cancel_transaction() const;
+        // Asynchronously acquire the write lock and call `fn` on the Realm's scheduler
+        // inside a write transaction, which `fn` must commit or cancel.
+        void async_begin_transaction(std::function<void()>&& fn) const;
+        // Commit the current write transaction and call `fn` on the Realm's scheduler
+        // once the changes have been persisted.
+        void async_commit_transaction(std::function<void(std::exception_ptr)>&& fn) const;
         table table_for_object_type(const std::string& object_type);
         table get_table(const uint32_t &);
         [[nodiscard]] std::shared_ptr<struct scheduler> scheduler() const;
@@ -1,10 +1,13 @@
 #include <cpprealm/internal/bridge/results.hpp>
 
+#include <cpprealm/internal/bridge/col_key.hpp>
+#include <cpprealm/internal/bridge/mixed.hpp>
 #include <cpprealm/internal/bridge/obj.hpp>
 #include <cpprealm/internal/bridge/query.hpp>
 #include <cpprealm/internal/bridge/realm.hpp>
 #include <cpprealm/internal/bridge/table.hpp>
 #include <realm/object-store/results.hpp>
+#include <realm/object-store/shared_realm.hpp>
 
 namespace realm::internal::bridge {
     results::results() {
@@ -99,6 +102,57 @@ namespace realm::internal::bridge {
 #endif
     }
 
+    query results::get_query() const {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        return reinterpret_cast<const Results*>(&m_results)->get_query();
+#else
+        return m_results->get_query();
+#endif
+    }
+
+    results results::sort(const std::vector<std::pair<std::string, bool>>& key_paths) const {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        return reinterpret_cast<const Results*>(&m_results)->sort(key_paths);
+#else
+        return m_results->sort(key_paths);
+#endif
+    }
+
+    results results::limit(size_t max_count) const {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        return reinterpret_cast<const Results*>(&m_results)->limit(max_count);
+#else
+        return m_results->limit(max_count);
+#endif
+    }
+
+    void results::clear() {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        reinterpret_cast<Results*>(&m_results)->clear();
+#else
+        m_results->clear();
+#endif
+    }
+
+    void results::set_all(const col_key& column, const mixed& value) {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        auto& r = *reinterpret_cast<Results*>(&m_results);
+#else
+        auto& r = *m_results;
+#endif
+        r.get_realm()->verify_in_write();
+        // The view is not brought up to date while it is updated, so objects which stop
+        // matching are still visited, and each object is visited once.
+        TableView view = r.get_tableview();
+        ColKey col = column;
+        auto v = static_cast<Mixed>(value);
+        for (size_t i = 0; i < view.size(); ++i) {
+            if (auto o = view.try_get_object(i)) {
+                o.set_any(col, v);
+            }
+        }
+    }
+
     template <>
     obj get(results& res, size_t v) {
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
@@ -108,10 +162,10 @@ namespace realm::internal::bridge {
 #endif
     }
 
-    notification_token results::add_notification_callback(std::shared_ptr<collection_change_callback> &&cb) {
-        struct wrapper : CollectionChangeCallback {
+    namespace {
+        struct callback_wrapper : CollectionChangeCallback {
             std::shared_ptr<collection_change_callback> m_cb;
-            explicit wrapper(std::shared_ptr<collection_change_callback>&& cb)
+            explicit callback_wrapper(std::shared_ptr<collection_change_callback>&& cb)
                     : m_cb(std::move(cb)) {}
             void before(const CollectionChangeSet& v) const {
                 m_cb->before(v);
@@ -119,7 +173,11 @@ namespace realm::internal::bridge {
             void after(const CollectionChangeSet& v) const {
                 m_cb->after(v);
             }
-        } ccb(std::move(cb));
+        };
+    }
+
+    notification_token results::add_notification_callback(std::shared_ptr<collection_change_callback> &&cb) {
+        callback_wrapper ccb(std::move(cb));
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         return reinterpret_cast<Results*>(&m_results)->add_notification_callback(ccb);
 #else
@@ -127,6 +185,23 @@ namespace realm::internal::bridge {
 #endif
     }
 
+    notification_token results::add_notification_callback(std::shared_ptr<collection_change_callback> &&cb,
+                                                          const key_path_array &key_paths) {
+        callback_wrapper ccb(std::move(cb));
+        KeyPathArray core_key_paths;
+        for (auto& path : key_paths) {
+            KeyPath& core_path = core_key_paths.emplace_back();
+            for (auto& [table_key, col_key] : path) {
+                core_path.emplace_back(TableKey(table_key), ColKey(col_key));
+            }
+        }
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        return reinterpret_cast<Results*>(&m_results)->add_notification_callback(ccb, std::move(core_key_paths));
+#else
+        return m_results->add_notification_callback(ccb, std::move(core_key_paths));
+#endif
+    }
+
     results::results(const realm &realm, const table_view &tv) {
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         new (&m_results) Results(realm, tv);
@@ -2,6 +2,9 @@
 #define CPP_REALM_BRIDGE_RESULTS_HPP
 
 #include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
 #include <cpprealm/internal/bridge/obj.hpp>
 #include <cpprealm/internal/bridge/utils.hpp>
 
@@ -15,6 +18,8 @@ namespace realm::internal::bridge {
     struct notification_token;
     struct obj;
     struct collection_change_set;
+    struct col_key;
+    struct mixed;
 
     struct results {
         results();
@@ -29,8 +34,19 @@ namespace realm::internal::bridge {
         size_t size();
         [[nodiscard]] realm get_realm() const;
         [[nodiscard]] table get_table() const;
+        [[nodiscard]] query get_query() const;
+        // Sorted by the given properties, each ascending if paired with `true`.
+        [[nodiscard]] results sort(const std::vector<std::pair<std::string, bool>>& key_paths) const;
+        [[nodiscard]] results limit(size_t max_count) const;
+        // Deletes every object in the results. Must be called within a write transaction.
+        void clear();
+        // Sets `column` of every object in the results to `value`, in one pass over the objects
+        // which match when it is called. Must be called within a write transaction.
+        void set_all(const col_key& column, const mixed& value);
         results(const realm&, const query&);
         notification_token add_notification_callback(std::shared_ptr<collection_change_callback>&&);
+        notification_token add_notification_callback(std::shared_ptr<collection_change_callback>&&,
+                                                     const key_path_array&);
     private:
         template <typename T>
         friend T get(results&, size_t);
@@ -105,6 +105,15 @@ namespace realm::internal::bridge {
         return get_set()->get<Obj>(i);
     }
 
+    void set::get_any_range(size_t begin, size_t end, std::vector<mixed>& out) const {
+        auto set = get_set();
+        out.clear();
+        out.reserve(end - begin);
+        for (size_t i = begin; i < end; i++) {
+            out.emplace_back(set->get_any(i));
+        }
+    }
+
     set::operator object_store::Set() const {
         return *get_set();
     }
@@ -115,10 +124,38 @@ namespace realm::internal::bridge {
     size_t set::size() const {
         return get_set()->size();
     }
+    bool set::is_valid() const {
+        return get_set()->is_valid();
+    }
     void set::remove_all() {
         get_set()->remove_all();
     }
 
+    bool set::is_subset_of(const set& rhs) const {
+        return get_set()->is_subset_of(*rhs.get_set());
+    }
+    bool set::is_superset_of(const set& rhs) const {
+        return get_set()->is_superset_of(*rhs.get_set());
+    }
+    bool set::intersects(const set& rhs) const {
+        return get_set()->intersects(*rhs.get_set());
+    }
+    bool set::set_equals(const set& rhs) const {
+        return get_set()->set_equals(*rhs.get_set());
+    }
+    void set::assign_union(const set& rhs) {
+        get_set()->assign_union(*rhs.get_set());
+    }
+    void set::assign_intersection(const set& rhs) {
+        get_set()->assign_intersection(*rhs.get_set());
+    }
+    void set::assign_difference(const set& rhs) {
+        get_set()->assign_difference(*rhs.get_set());
+    }
+    void set::assign_symmetric_difference(const set& rhs) {
+        get_set()->assign_symmetric_difference(*rhs.get_set());
+    }
+
     std::pair<size_t, bool> set::insert(const std::string &v) {
         return get_set()->insert(StringData(v));
     }
@@ -5,6 +5,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 #include <cpprealm/internal/bridge/utils.hpp>
 
 namespace realm {
@@ -44,10 +45,25 @@ namespace realm::internal::bridge {
 
         mixed get_any(const size_t& i) const;
         obj get_obj(const size_t& i) const;
+        // Reads the elements in `[begin, end)` into `out`, replacing its contents, with a single
+        // call into the bridge. The elements are read from core one at a time.
+        void get_any_range(size_t begin, size_t end, std::vector<mixed>& out) const;
 
         [[nodiscard]] size_t size() const;
+        // Whether the set can still be accessed, i.e. its Realm is open and its parent object exists.
+        [[nodiscard]] bool is_valid() const;
         void remove_all();
 
+        // Set algebra evaluated by the Realm. Both sets must be of the same type.
+        [[nodiscard]] bool is_subset_of(const set& rhs) const;
+        [[nodiscard]] bool is_superset_of(const set& rhs) const;
+        [[nodiscard]] bool intersects(const set& rhs) const;
+        [[nodiscard]] bool set_equals(const set& rhs) const;
+        void assign_union(const set& rhs);
+        void assign_intersection(const set& rhs);
+        void assign_difference(const set& rhs);
+        void assign_symmetric_difference(const set& rhs);
+
         table get_table() const;
 
         std::pair<size_t, bool> insert(const std::string&);
@@ -72,6 +72,32 @@ namespace realm::internal::bridge {
         return f;
     }
 
+#ifdef CPPREALM_HAVE_COROUTINES
+    completion_awaitable sync_session::async_wait_for_upload_completion(const std::shared_ptr<struct scheduler>& scheduler) {
+        return completion_awaitable([session = m_session](completion_awaitable::completion&& done) {
+            if (auto s = session.lock()) {
+                s->wait_for_upload_completion([done = std::move(done)](::realm::Status s) {
+                    done(s.is_ok() ? nullptr : std::make_exception_ptr(s.code()));
+                });
+            } else {
+                done(std::make_exception_ptr(std::runtime_error("Realm: Error accessing sync_session which has been destroyed.")));
+            }
+        }, scheduler);
+    }
+
+    completion_awaitable sync_session::async_wait_for_download_completion(const std::shared_ptr<struct scheduler>& scheduler) {
+        return completion_awaitable([session = m_session](completion_awaitable::completion&& done) {
+            if (auto s = session.lock()) {
+                s->wait_for_download_completion([done = std::move(done)](::realm::Status s) {
+                    done(s.is_ok() ? nullptr : std::make_exception_ptr(s.code()));
+                });
+            } else {
+                done(std::make_exception_ptr(std::runtime_error("Realm: Error accessing sync_session which has been destroyed.")));
+            }
+        }, scheduler);
+    }
+#endif
+
     sync_session::sync_session(const std::shared_ptr<SyncSession> &v) {
         m_session = v;
     }
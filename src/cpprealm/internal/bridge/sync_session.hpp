@@ -6,6 +6,8 @@
 #include <future>
 #include <system_error>
 
+#include <cpprealm/task.hpp>
+
 namespace realm {
     class SyncSession;
     namespace internal::bridge {
@@ -35,6 +37,13 @@ namespace realm {
             std::future<void> wait_for_upload_completion();
             // Register a callback that will be called when all pending downloads have been completed.
             std::future<void> wait_for_download_completion();
+#ifdef CPPREALM_HAVE_COROUTINES
+            // Awaitable versions of the above which do not block a thread while waiting.
+            // The awaiting coroutine is resumed on `scheduler` if given, otherwise upon
+            // whatever thread the underlying sync client completes the wait on.
+            [[nodiscard]] completion_awaitable async_wait_for_upload_completion(const std::shared_ptr<struct scheduler>& scheduler = nullptr);
+            [[nodiscard]] completion_awaitable async_wait_for_download_completion(const std::shared_ptr<struct scheduler>& scheduler = nullptr);
+#endif
         private:
             std::weak_ptr<SyncSession> m_session;
         };
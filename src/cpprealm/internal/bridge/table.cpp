@@ -1,4 +1,5 @@
 #include <cpprealm/internal/bridge/table.hpp>
+#include <cpprealm/query_cache.hpp>
 #include <cpprealm/internal/bridge/mixed.hpp>
 #include <cpprealm/internal/bridge/obj.hpp>
 #include <cpprealm/internal/bridge/query.hpp>
@@ -103,11 +104,12 @@ namespace realm::internal::bridge {
 
     query table::query(const std::string& a,
                        const std::vector<mixed>& b) const {
-        std::vector<Mixed> v2;
-        for (auto& v : b) {
-            v2.push_back(v.operator ::realm::Mixed());
-        }
-        return static_cast<TableRef>(*this)->query(a, v2);
+        return parse_query(*this, a, b);
+    }
+
+    query table::query(const std::string& a,
+                       const std::vector<query_argument>& b) const {
+        return parse_query(*this, a, b);
     }
 
     obj table::create_object(const obj_key &obj_key) const {
@@ -129,6 +131,10 @@ namespace realm::internal::bridge {
     obj table::create_object_with_primary_key(const bridge::mixed& key) const {
         return static_cast<TableRef>(*this)->create_object_with_primary_key(key.operator ::realm::Mixed());
     }
+    uint32_t table::get_key() const {
+        return static_cast<TableRef>(*this)->get_key().value;
+    }
+
     bool table::is_valid(const obj_key &key) const {
         return static_cast<TableRef>(*this)->is_valid(key);
     }
@@ -14,6 +14,7 @@ namespace realm {
     namespace internal::bridge {
         struct obj;
         struct mixed;
+        struct query_argument;
         struct col_key;
         struct query;
 
@@ -30,6 +31,7 @@ namespace realm {
             operator ConstTableRef() const;
 
             col_key get_column_key(const std::string_view &name) const;
+            [[nodiscard]] uint32_t get_key() const;
 
             obj create_object_with_primary_key(const mixed &key) const;
 
@@ -40,6 +42,7 @@ namespace realm {
             [[nodiscard]] bool is_embedded() const;
 
             struct query query(const std::string &, const std::vector <mixed>&) const;
+            struct query query(const std::string &, const std::vector <query_argument>&) const;
 
             void remove_object(const obj_key &) const;
             obj get_object(const obj_key&) const;
@@ -0,0 +1,295 @@
+#include <cpprealm/page_cursor.hpp>
+#include <cpprealm/query_cache.hpp>
+#include <cpprealm/internal/bridge/mixed.hpp>
+#include <cpprealm/internal/bridge/obj.hpp>
+#include <cpprealm/internal/bridge/query.hpp>
+#include <cpprealm/internal/bridge/table.hpp>
+
+#include <realm/decimal128.hpp>
+#include <realm/mixed.hpp>
+#include <realm/obj.hpp>
+#include <realm/object_id.hpp>
+#include <realm/table.hpp>
+#include <realm/timestamp.hpp>
+#include <realm/uuid.hpp>
+
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+
+namespace realm {
+    namespace {
+        constexpr char cursor_version = '1';
+
+        [[noreturn]] void invalid_cursor() {
+            throw std::invalid_argument("Invalid page cursor.");
+        }
+
+        // Fields are encoded as a tag, the length of the value and the value, e.g. `i2:42`.
+        void write_field(std::string& out, char tag, std::string_view value) {
+            out += tag;
+            out += std::to_string(value.size());
+            out += ':';
+            out += value;
+        }
+
+        std::pair<char, std::string_view> read_field(std::string_view& in) {
+            auto separator = in.find(':');
+            if (in.size() < 2 || separator == std::string_view::npos || separator < 2) {
+                invalid_cursor();
+            }
+            size_t length = 0;
+            for (auto c : in.substr(1, separator - 1)) {
+                if (c < '0' || c > '9' || length > in.size()) {
+                    invalid_cursor();
+                }
+                length = length * 10 + static_cast<size_t>(c - '0');
+            }
+            if (in.size() - separator - 1 < length) {
+                invalid_cursor();
+            }
+            std::pair<char, std::string_view> ret{in[0], in.substr(separator + 1, length)};
+            in.remove_prefix(separator + 1 + length);
+            return ret;
+        }
+
+        template<typename Int, typename Float>
+        std::string float_bits(Float value) {
+            Int bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return std::to_string(bits);
+        }
+
+        template<typename Int, typename Float>
+        Float float_from_bits(std::string_view text) {
+            Int bits = static_cast<Int>(std::stoull(std::string(text)));
+            Float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        void write_value(std::string& out, const Mixed& value) {
+            if (value.is_null()) {
+                return write_field(out, 'n', {});
+            }
+            switch (value.get_type()) {
+                case type_Int:
+                    return write_field(out, 'i', std::to_string(value.get_int()));
+                case type_Bool:
+                    return write_field(out, 'b', value.get_bool() ? "1" : "0");
+                case type_String: {
+                    auto str = value.get_string();
+                    return write_field(out, 's', std::string_view(str.data(), str.size()));
+                }
+                case type_Binary: {
+                    auto data = value.get_binary();
+                    return write_field(out, 'x', std::string_view(data.data(), data.size()));
+                }
+                case type_Timestamp: {
+                    auto ts = value.get_timestamp();
+                    return write_field(out, 't', std::to_string(ts.get_seconds()) + "," + std::to_string(ts.get_nanoseconds()));
+                }
+                case type_Float:
+                    return write_field(out, 'f', float_bits<uint32_t>(value.get_float()));
+                case type_Double:
+                    return write_field(out, 'd', float_bits<uint64_t>(value.get_double()));
+                case type_Decimal:
+                    return write_field(out, 'm', value.get<Decimal128>().to_string());
+                case type_ObjectId:
+                    return write_field(out, 'o', value.get<ObjectId>().to_string());
+                case type_UUID:
+                    return write_field(out, 'u', value.get<UUID>().to_string());
+                default:
+                    throw std::invalid_argument("Results can only be paged by properties of primitive types.");
+            }
+        }
+
+        // A cursor decoded into core values, which refer to the strings it owns.
+        struct decoded_cursor {
+            std::string property;
+            bool ascending = true;
+            std::vector<Mixed> keys;
+            std::string storage;
+
+            explicit decoded_cursor(const std::string& key) : storage(key) {
+                std::string_view in(storage);
+                try {
+                    auto [version_tag, version] = read_field(in);
+                    auto [property_tag, name] = read_field(in);
+                    auto [order_tag, order] = read_field(in);
+                    if (version_tag != 'v' || version != std::string_view(&cursor_version, 1) ||
+                        property_tag != 'p' || order_tag != 'o' || (order != "a" && order != "d")) {
+                        invalid_cursor();
+                    }
+                    property = std::string(name);
+                    ascending = order == "a";
+                    while (!in.empty()) {
+                        auto [tag, value] = read_field(in);
+                        keys.push_back(read_value(tag, value));
+                    }
+                } catch (const std::exception&) {
+                    // Also thrown by core for malformed values, and by `std::stoll` for out of range numbers.
+                    invalid_cursor();
+                }
+                if (keys.empty() || keys.size() > 2) {
+                    invalid_cursor();
+                }
+            }
+
+        private:
+            static Mixed read_value(char tag, std::string_view value) {
+                switch (tag) {
+                    case 'n':
+                        return Mixed();
+                    case 'i':
+                        return Mixed(int64_t(std::stoll(std::string(value))));
+                    case 'b':
+                        return Mixed(value == "1");
+                    case 's':
+                        return Mixed(StringData(value.data(), value.size()));
+                    case 'x':
+                        return Mixed(BinaryData(value.data(), value.size()));
+                    case 't': {
+                        auto comma = value.find(',');
+                        if (comma == std::string_view::npos) {
+                            invalid_cursor();
+                        }
+                        return Mixed(Timestamp(std::stoll(std::string(value.substr(0, comma))),
+                                               std::stoi(std::string(value.substr(comma + 1)))));
+                    }
+                    case 'f':
+                        return Mixed(float_from_bits<uint32_t, float>(value));
+                    case 'd':
+                        return Mixed(float_from_bits<uint64_t, double>(value));
+                    case 'm':
+                        return Mixed(Decimal128(StringData(value.data(), value.size())));
+                    case 'o':
+                        if (!ObjectId::is_valid_str(StringData(value.data(), value.size()))) {
+                            invalid_cursor();
+                        }
+                        return Mixed(ObjectId(std::string(value).c_str()));
+                    case 'u':
+                        return Mixed(UUID(StringData(value.data(), value.size())));
+                    default:
+                        invalid_cursor();
+                }
+            }
+        };
+
+        // The primary key orders objects with the same sort key, unless it is the sort key.
+        ColKey tiebreak_column(const TableRef& table, ColKey sort_column) {
+            auto pk = table->get_primary_key_column();
+            return pk == sort_column ? ColKey() : pk;
+        }
+
+        ColKey sort_column(const TableRef& table, const std::string& property) {
+            auto col = table->get_column_key(property);
+            if (!col) {
+                throw std::invalid_argument("Cannot page by '" + property + "', which is not a property of '" +
+                                            std::string(table->get_class_name()) + "'.");
+            }
+            return col;
+        }
+    }
+
+    struct page_cursor_access {
+        static const std::string& key(const page_cursor& cursor) {
+            return cursor.m_key;
+        }
+        static page_cursor make(std::string key) {
+            return page_cursor(std::move(key));
+        }
+    };
+
+    std::string page_cursor::to_string() const {
+        static constexpr char digits[] = "0123456789abcdef";
+        std::string ret;
+        ret.reserve(m_key.size() * 2);
+        for (unsigned char c : m_key) {
+            ret += digits[c >> 4];
+            ret += digits[c & 0xf];
+        }
+        return ret;
+    }
+
+    page_cursor page_cursor::from_string(const std::string& token) {
+        if (token.size() % 2) {
+            invalid_cursor();
+        }
+        auto nibble = [](char c) {
+            if (c >= '0' && c <= '9') return c - '0';
+            if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+            invalid_cursor();
+        };
+        std::string key;
+        key.reserve(token.size() / 2);
+        for (size_t i = 0; i < token.size(); i += 2) {
+            key += static_cast<char>((nibble(token[i]) << 4) | nibble(token[i + 1]));
+        }
+        if (!key.empty()) {
+            // Validates the token.
+            decoded_cursor decoded(key);
+        }
+        return page_cursor(std::move(key));
+    }
+
+    namespace internal::bridge {
+        std::vector<std::pair<std::string, bool>> page_ordering(const table& table, const std::string& property,
+                                                                bool ascending) {
+            auto t = static_cast<TableRef>(table);
+            std::vector<std::pair<std::string, bool>> ret{{property, ascending}};
+            if (auto pk = tiebreak_column(t, sort_column(t, property))) {
+                ret.emplace_back(std::string(t->get_column_name(pk)), true);
+            }
+            return ret;
+        }
+
+        query page_query(const table& table, const std::string& property, bool ascending, const page_cursor& cursor) {
+            auto t = static_cast<TableRef>(table);
+            auto col = sort_column(t, property);
+            auto pk = tiebreak_column(t, col);
+            decoded_cursor decoded(page_cursor_access::key(cursor));
+            if (decoded.property != property || decoded.ascending != ascending || decoded.keys.size() != (pk ? 2 : 1)) {
+                throw std::invalid_argument("The page cursor was returned for results in another order.");
+            }
+
+            // Nulls sort before all other values, so come first in ascending order and last in descending order.
+            const std::string k = property;
+            bool is_null = decoded.keys[0].is_null();
+            std::string after;
+            if (ascending) {
+                after = is_null ? k + " != $0" : k + " > $0";
+            } else if (!is_null) {
+                after = col.is_nullable() ? k + " < $0 OR " + k + " == NULL" : k + " < $0";
+            }
+            if (pk) {
+                auto tiebreak = k + " == $0 AND " + std::string(t->get_column_name(pk)) + " > $1";
+                after = after.empty() ? tiebreak : after + " OR (" + tiebreak + ")";
+            } else if (after.empty()) {
+                after = "FALSEPREDICATE";
+            }
+
+            std::vector<mixed> arguments;
+            arguments.reserve(decoded.keys.size());
+            for (auto& key : decoded.keys) {
+                arguments.emplace_back(key);
+            }
+            return parse_query(table, after, arguments);
+        }
+
+        page_cursor make_page_cursor(const obj& last, const std::string& property, bool ascending) {
+            Obj o = last;
+            auto table = o.get_table();
+            auto col = sort_column(table, property);
+            std::string key;
+            write_field(key, 'v', std::string_view(&cursor_version, 1));
+            write_field(key, 'p', property);
+            write_field(key, 'o', ascending ? "a" : "d");
+            write_value(key, o.get_any(col));
+            if (auto pk = tiebreak_column(table, col)) {
+                write_value(key, o.get_any(pk));
+            }
+            return page_cursor_access::make(std::move(key));
+        }
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef CPP_REALM_PAGE_CURSOR_HPP
+#define CPP_REALM_PAGE_CURSOR_HPP
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace realm {
+    /**
+     A position in results sorted by `results<T>::sorted_by`, between the last object of one
+     page and the first object of the next. The cursor holds the sort key of the last object
+     and, when the object type has a primary key, its primary key, which orders objects with
+     the same sort key.
+
+     Cursors are opaque. `to_string()` returns a token of hexadecimal digits which can be
+     stored or sent to clients, and `from_string()` reads it back.
+     */
+    struct page_cursor {
+        /// The position before the first object.
+        page_cursor() = default;
+
+        /// Throws `std::invalid_argument` if `token` was not returned by `to_string()`.
+        static page_cursor from_string(const std::string& token);
+        [[nodiscard]] std::string to_string() const;
+
+        /// Whether this is the position before the first object.
+        [[nodiscard]] bool is_start() const noexcept {
+            return m_key.empty();
+        }
+
+        friend bool operator==(const page_cursor& lhs, const page_cursor& rhs) {
+            return lhs.m_key == rhs.m_key;
+        }
+        friend bool operator!=(const page_cursor& lhs, const page_cursor& rhs) {
+            return !(lhs == rhs);
+        }
+
+    private:
+        explicit page_cursor(std::string key) : m_key(std::move(key)) {}
+        // The encoded ordering and values, empty for the start.
+        std::string m_key;
+        friend struct page_cursor_access;
+    };
+
+    namespace internal::bridge {
+        struct table;
+        struct query;
+        struct obj;
+
+        // The sort order of pages of `table` by `property`: the property, then the primary key.
+        std::vector<std::pair<std::string, bool>> page_ordering(const table& table, const std::string& property,
+                                                                bool ascending);
+        // Matches the objects which come after `cursor` in the order given by `page_ordering`.
+        // Throws `std::invalid_argument` if the cursor was returned for another order.
+        query page_query(const table& table, const std::string& property, bool ascending, const page_cursor& cursor);
+        // The position after `last`, the last object of a page.
+        page_cursor make_page_cursor(const obj& last, const std::string& property, bool ascending);
+    }
+}
+
+#endif //CPP_REALM_PAGE_CURSOR_HPP
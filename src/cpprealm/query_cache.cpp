@@ -0,0 +1,287 @@
+#include <cpprealm/query_cache.hpp>
+#include <cpprealm/internal/bridge/geospatial.hpp>
+#include <cpprealm/internal/bridge/mixed.hpp>
+#include <cpprealm/internal/bridge/query.hpp>
+#include <cpprealm/internal/bridge/table.hpp>
+
+#include <realm/parser/driver.hpp>
+#include <realm/parser/keypath_mapping.hpp>
+#include <realm/parser/query_parser.hpp>
+#include <realm/query.hpp>
+#include <realm/sort_descriptor.hpp>
+#include <realm/table.hpp>
+#if REALM_ENABLE_GEOSPATIAL
+#include <realm/geospatial.hpp>
+#endif
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+
+namespace realm {
+    namespace {
+        // A query argument converted to core values, either a single value, a list or a region.
+        struct bound_argument {
+            Mixed value;
+            bool is_list = false;
+            std::vector<Mixed> list;
+#if REALM_ENABLE_GEOSPATIAL
+            std::optional<Geospatial> shape;
+#endif
+        };
+
+        // Arguments of a parsed query which are replaced each time the query is built.
+        class late_bound_arguments final : public query_parser::Arguments {
+        public:
+            late_bound_arguments() : query_parser::Arguments(0) {}
+
+            void bind(const std::vector<bound_argument>* args) {
+                m_args = args;
+                m_count = args ? args->size() : 0;
+            }
+
+            bool bool_for_argument(size_t i) { return at(i).get_bool(); }
+            long long long_for_argument(size_t i) { return at(i).get_int(); }
+            float float_for_argument(size_t i) { return at(i).get_float(); }
+            double double_for_argument(size_t i) { return at(i).get_double(); }
+            StringData string_for_argument(size_t i) { return at(i).get_string(); }
+            BinaryData binary_for_argument(size_t i) { return at(i).get_binary(); }
+            Timestamp timestamp_for_argument(size_t i) { return at(i).get_timestamp(); }
+            ObjKey object_index_for_argument(size_t i) { return at(i).get<ObjKey>(); }
+            ObjectId objectid_for_argument(size_t i) { return at(i).get_object_id(); }
+            Decimal128 decimal128_for_argument(size_t i) { return at(i).get<Decimal128>(); }
+            UUID uuid_for_argument(size_t i) { return at(i).get<UUID>(); }
+            ObjLink objlink_for_argument(size_t i) { return at(i).get<ObjLink>(); }
+#if REALM_ENABLE_GEOSPATIAL
+            Geospatial geospatial_for_argument(size_t i) {
+                verify_ndx(i);
+                auto& arg = (*m_args)[i];
+                if (!arg.shape) {
+                    throw std::invalid_argument("Expected a geospatial region for a query argument.");
+                }
+                return *arg.shape;
+            }
+#endif
+            std::vector<Mixed> list_for_argument(size_t i) {
+                verify_ndx(i);
+                return (*m_args)[i].list;
+            }
+            bool is_argument_null(size_t i) { return !is_argument_list(i) && !is_argument_shape(i) && at(i).is_null(); }
+            bool is_argument_list(size_t i) {
+                verify_ndx(i);
+                return (*m_args)[i].is_list;
+            }
+            DataType type_for_argument(size_t i) { return at(i).get_type(); }
+
+        private:
+            bool is_argument_shape(size_t i) {
+#if REALM_ENABLE_GEOSPATIAL
+                verify_ndx(i);
+                return (*m_args)[i].shape.has_value();
+#else
+                return false;
+#endif
+            }
+
+            const Mixed& at(size_t i) const {
+                verify_ndx(i);
+                auto& arg = (*m_args)[i];
+                if (arg.is_list) {
+                    throw std::invalid_argument("Expected a single value for a query argument but it is a list.");
+                }
+#if REALM_ENABLE_GEOSPATIAL
+                if (arg.shape) {
+                    throw std::invalid_argument("Expected a single value for a query argument but it is a geospatial region.");
+                }
+#endif
+                return arg.value;
+            }
+
+            const std::vector<bound_argument>* m_args = nullptr;
+        };
+
+        struct parsed_query {
+            parsed_query(const TableRef& table, const std::string& query_string)
+                : text(query_string), table(table), driver(table, arguments, query_parser::KeyPathMapping()) {
+                driver.parse(text);
+                driver.result->canonicalize();
+            }
+
+            Query build(const std::vector<bound_argument>& args) {
+                std::lock_guard<std::mutex> lock(mutex);
+                arguments.bind(&args);
+                auto q = driver.result->visit(&driver).set_ordering(driver.ordering->visit(&driver));
+                arguments.bind(nullptr);
+                return q;
+            }
+
+            const std::string text;
+            const TableRef table;
+            std::mutex mutex;
+            // Referenced by the driver, so declared before it.
+            late_bound_arguments arguments;
+            ParserDriver driver;
+        };
+
+        struct cache_key {
+            std::string_view text;
+            const void* table;
+
+            bool operator==(const cache_key& other) const {
+                return table == other.table && text == other.text;
+            }
+        };
+
+        struct cache_key_hash {
+            size_t operator()(const cache_key& key) const {
+                return std::hash<std::string_view>()(key.text) ^ (std::hash<const void*>()(key.table) << 1);
+            }
+        };
+
+        /**
+         A least recently used cache of parsed queries, keyed by query string and table
+         accessor. The keys refer to the query string owned by the entry.
+         */
+        class query_cache {
+        public:
+            static query_cache& shared() {
+                static query_cache cache;
+                return cache;
+            }
+
+            Query query(const TableRef& table, const std::string& query_string, const std::vector<bound_argument>& args) {
+                auto entry = find_or_parse(table, query_string);
+                if (!entry) {
+                    late_bound_arguments arguments;
+                    arguments.bind(&args);
+                    return table->query(query_string, arguments, query_parser::KeyPathMapping());
+                }
+                return entry->build(args);
+            }
+
+            query_cache_stats stats() {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                auto stats = m_stats;
+                stats.size = m_entries.size();
+                stats.capacity = m_capacity;
+                return stats;
+            }
+
+            void set_capacity(size_t capacity) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_capacity = capacity;
+                evict();
+            }
+
+            void clear() {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_index.clear();
+                m_entries.clear();
+                m_stats = {};
+            }
+
+        private:
+            using entry_list = std::list<std::shared_ptr<parsed_query>>;
+
+            std::shared_ptr<parsed_query> find_or_parse(const TableRef& table, const std::string& query_string) {
+                cache_key key{query_string, table.unchecked_ptr()};
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (m_capacity == 0) {
+                        return nullptr;
+                    }
+                    if (auto it = m_index.find(key); it != m_index.end()) {
+                        // The accessor may have been replaced by one for another version of the table.
+                        if ((*it->second)->table == table) {
+                            m_entries.splice(m_entries.begin(), m_entries, it->second);
+                            ++m_stats.hits;
+                            return m_entries.front();
+                        }
+                        erase(it);
+                    }
+                    ++m_stats.misses;
+                }
+
+                // Parse outside of the lock, parse errors are thrown to the caller.
+                auto entry = std::make_shared<parsed_query>(table, query_string);
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (auto it = m_index.find(key); it != m_index.end()) {
+                    erase(it);
+                }
+                m_entries.push_front(entry);
+                m_index.emplace(cache_key{entry->text, key.table}, m_entries.begin());
+                evict();
+                return entry;
+            }
+
+            void erase(std::unordered_map<cache_key, entry_list::iterator, cache_key_hash>::iterator it) {
+                auto entry = it->second;
+                m_index.erase(it);
+                m_entries.erase(entry);
+            }
+
+            void evict() {
+                while (m_entries.size() > m_capacity) {
+                    auto& entry = m_entries.back();
+                    m_index.erase(cache_key{entry->text, entry->table.unchecked_ptr()});
+                    m_entries.pop_back();
+                    ++m_stats.evictions;
+                }
+            }
+
+            std::mutex m_mutex;
+            size_t m_capacity = 64;
+            entry_list m_entries;
+            std::unordered_map<cache_key, entry_list::iterator, cache_key_hash> m_index;
+            query_cache_stats m_stats;
+        };
+    }
+
+    query_cache_stats get_query_cache_stats() {
+        return query_cache::shared().stats();
+    }
+
+    void set_query_cache_capacity(size_t capacity) {
+        query_cache::shared().set_capacity(capacity);
+    }
+
+    void clear_query_cache() {
+        query_cache::shared().clear();
+    }
+
+    namespace internal::bridge {
+        query parse_query(const table& table, const std::string& query_string, const std::vector<mixed>& arguments) {
+            std::vector<bound_argument> args(arguments.size());
+            for (size_t i = 0; i < arguments.size(); i++) {
+                args[i].value = arguments[i].operator ::realm::Mixed();
+            }
+            return query_cache::shared().query(static_cast<TableRef>(table), query_string, args);
+        }
+
+        query parse_query(const table& table, const std::string& query_string, const std::vector<query_argument>& arguments) {
+            std::vector<bound_argument> args(arguments.size());
+            for (size_t i = 0; i < arguments.size(); i++) {
+                if (arguments[i].is_list()) {
+                    args[i].is_list = true;
+                    args[i].list.reserve(arguments[i].list().size());
+                    for (auto& value : arguments[i].list()) {
+                        args[i].list.push_back(value.operator ::realm::Mixed());
+                    }
+                } else if (auto& shape = arguments[i].shape()) {
+#if REALM_ENABLE_GEOSPATIAL
+                    args[i].shape = static_cast<Geospatial>(*shape);
+#else
+                    throw std::invalid_argument("Geospatial queries are not supported by this build of Realm Core.");
+#endif
+                } else {
+                    args[i].value = arguments[i].value().operator ::realm::Mixed();
+                }
+            }
+            return query_cache::shared().query(static_cast<TableRef>(table), query_string, args);
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#ifndef CPP_REALM_QUERY_CACHE_HPP
+#define CPP_REALM_QUERY_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace realm {
+    /**
+     Counters of the cache of parsed query strings. Queries given as strings to
+     `results<T>::where` or to a subscription set are parsed once per query string and
+     table, and the parsed query is bound to new arguments on later uses.
+     */
+    struct query_cache_stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        /// The number of parsed queries currently cached.
+        size_t size = 0;
+        size_t capacity = 0;
+    };
+
+    query_cache_stats get_query_cache_stats();
+    /// Sets the maximum number of parsed queries kept, evicting the least recently used ones.
+    /// A capacity of zero disables the cache.
+    void set_query_cache_capacity(size_t capacity);
+    /// Removes all parsed queries from the cache and resets its counters.
+    void clear_query_cache();
+
+    namespace internal::bridge {
+        struct table;
+        struct query;
+        struct mixed;
+        struct query_argument;
+
+        // Builds the query for `query_string` on `table` through the shared cache of parsed queries.
+        query parse_query(const table& table, const std::string& query_string, const std::vector<mixed>& arguments);
+        query parse_query(const table& table, const std::string& query_string, const std::vector<query_argument>& arguments);
+    }
+}
+
+#endif //CPP_REALM_QUERY_CACHE_HPP
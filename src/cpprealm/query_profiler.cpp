@@ -0,0 +1,136 @@
+#include <cpprealm/query_profiler.hpp>
+#include <cpprealm/internal/bridge/query.hpp>
+#include <cpprealm/internal/bridge/realm.hpp>
+#include <cpprealm/internal/bridge/results.hpp>
+
+#include <realm/object-store/results.hpp>
+#include <realm/query.hpp>
+#include <realm/table.hpp>
+#include <realm/table_view.hpp>
+#include <realm/util/logger.hpp>
+
+#include <atomic>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+
+namespace realm {
+    namespace {
+        struct profiler_state {
+            std::mutex mutex;
+            std::function<void(const query_timing&)> profiler;
+            std::optional<std::chrono::microseconds> threshold;
+            logger::level level = logger::level::warn;
+            // Checked without taking the lock on every query.
+            std::atomic<bool> enabled{false};
+
+            static profiler_state& shared() {
+                static profiler_state state;
+                return state;
+            }
+
+            void update_enabled() {
+                enabled = profiler || threshold;
+            }
+        };
+
+        std::string describe(const Query& query) {
+            try {
+                return query.get_description();
+            } catch (const std::exception&) {
+                // Some conditions, such as those on links to objects, cannot be described.
+                return "<query>";
+            }
+        }
+
+        std::string milliseconds(std::chrono::nanoseconds duration) {
+            std::ostringstream ss;
+            ss << std::fixed << std::setprecision(3) << std::chrono::duration<double, std::milli>(duration).count() << "ms";
+            return ss.str();
+        }
+
+        void report(const query_timing& timing) {
+            auto& state = profiler_state::shared();
+            std::function<void(const query_timing&)> profiler;
+            std::optional<std::chrono::microseconds> threshold;
+            logger::level level;
+            {
+                std::lock_guard<std::mutex> lock(state.mutex);
+                profiler = state.profiler;
+                threshold = state.threshold;
+                level = state.level;
+            }
+            if (profiler) {
+                profiler(timing);
+            }
+            if (threshold && timing.total() >= *threshold) {
+                if (auto logger = util::Logger::get_default_logger()) {
+                    std::ostringstream ss;
+                    ss << "Slow query took " << milliseconds(timing.total())
+                       << " (build " << milliseconds(timing.build)
+                       << ", evaluation " << milliseconds(timing.evaluation)
+                       << ", materialization " << milliseconds(timing.materialization)
+                       << ") and matched " << timing.matches << " objects: " << timing.description;
+                    logger->log(static_cast<util::Logger::Level>(level), "%1", ss.str());
+                }
+            }
+        }
+    }
+
+    void set_query_profiler(std::function<void(const query_timing&)> profiler) {
+        auto& state = profiler_state::shared();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.profiler = std::move(profiler);
+        state.update_enabled();
+    }
+
+    void set_slow_query_threshold(std::optional<std::chrono::microseconds> threshold, logger::level level) {
+        auto& state = profiler_state::shared();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.threshold = threshold;
+        state.level = level;
+        state.update_enabled();
+    }
+
+    namespace internal::bridge {
+        bool is_query_profiling_enabled() {
+            return profiler_state::shared().enabled.load(std::memory_order_relaxed);
+        }
+
+        results profile_query(const realm& realm, const std::function<query()>& build) {
+            using clock = std::chrono::steady_clock;
+            auto start = clock::now();
+            Query q = build();
+            auto built = clock::now();
+            // The query is evaluated once, and the number of matches is read from the view.
+            auto view = q.find_all();
+            auto evaluated = clock::now();
+            size_t matches = view.size();
+            results ret(Results(static_cast<std::shared_ptr<Realm>>(realm), std::move(view)));
+            auto materialized = clock::now();
+
+            query_timing timing;
+            timing.description = describe(q);
+            timing.build = built - start;
+            timing.evaluation = evaluated - built;
+            timing.materialization = materialized - evaluated;
+            timing.matches = matches;
+            report(timing);
+            return ret;
+        }
+
+        query_explanation explain(const query& query) {
+            Query q = query;
+            auto table = q.get_table();
+            query_explanation ret;
+            ret.description = describe(q);
+            if (auto column = query.indexed_column()) {
+                ret.index = std::string(table->get_column_name(*column));
+            }
+            ret.table_size = table->size();
+            ret.matches = q.count();
+            ret.selectivity = ret.table_size ? static_cast<double>(ret.matches) / static_cast<double>(ret.table_size) : 0;
+            return ret;
+        }
+    }
+}
@@ -0,0 +1,75 @@
+#ifndef CPP_REALM_QUERY_PROFILER_HPP
+#define CPP_REALM_QUERY_PROFILER_HPP
+
+#include <cpprealm/logger.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+
+namespace realm {
+    /**
+     How a query is evaluated, as returned by `results<T>::explain()`.
+     */
+    struct query_explanation {
+        /// The query in the query language, as described by core.
+        std::string description;
+        /// The property whose search index core looks up to find candidate objects instead of
+        /// scanning the table. Only reported for type-safe queries, as the conditions of query
+        /// strings are not known.
+        std::optional<std::string> index;
+        /// The number of objects in the queried table.
+        size_t table_size = 0;
+        /// The number of objects matching the query.
+        size_t matches = 0;
+        /// The fraction of the table matching the query.
+        double selectivity = 0;
+    };
+
+    /**
+     The time taken by the stages of a query built by `results<T>::where` or executed by
+     `prepared_query::execute`.
+     */
+    struct query_timing {
+        /// The query in the query language, as described by core.
+        std::string description;
+        /// Building the query from the type-safe predicate or the query string.
+        std::chrono::nanoseconds build{};
+        /// Evaluating the query against the table, collecting the matching objects into a view.
+        std::chrono::nanoseconds evaluation{};
+        /// Creating the results which read from that view.
+        std::chrono::nanoseconds materialization{};
+        size_t matches = 0;
+
+        [[nodiscard]] std::chrono::nanoseconds total() const {
+            return build + evaluation + materialization;
+        }
+    };
+
+    /// Calls `profiler` with the timing of each query subsequently built by `results<T>::where`
+    /// or executed by `prepared_query::execute`, or stops profiling if it is empty. While profiling, or logging slow queries, queries are
+    /// evaluated when they are built rather than when the results are first read, and the
+    /// matches are counted before being collected.
+    void set_query_profiler(std::function<void(const query_timing&)> profiler);
+    /// Logs queries built by `results<T>::where` or executed by `prepared_query::execute` which
+    /// take at least `threshold` in total through the default logger at `level`, or stops
+    /// logging them if `threshold` is empty.
+    void set_slow_query_threshold(std::optional<std::chrono::microseconds> threshold,
+                                  logger::level level = logger::level::warn);
+
+    namespace internal::bridge {
+        struct realm;
+        struct query;
+        struct results;
+
+        // Whether queries need to be built through `profile_query`.
+        bool is_query_profiling_enabled();
+        // Builds the query returned by `build` and evaluates it, reporting the time taken.
+        results profile_query(const realm& realm, const std::function<query()>& build);
+        query_explanation explain(const query& query);
+    }
+}
+
+#endif //CPP_REALM_QUERY_PROFILER_HPP
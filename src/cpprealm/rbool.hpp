@@ -192,17 +192,15 @@ namespace realm {
 
     inline rbool operator &&(const rbool& lhs, const rbool& rhs) {
         if (lhs.is_for_queries) {
-            lhs.q.and_query(rhs.q);
-            return lhs;
+            return lhs.q && rhs.q;
         }
         return lhs.b && rhs.b;
     }
     inline rbool operator ||(const rbool& lhs, const rbool& rhs) {
         if (lhs.is_for_queries) {
-            lhs.q = lhs.q || rhs.q;
-            return lhs;
+            return lhs.q || rhs.q;
         }
-        return lhs.b && rhs.b;
+        return lhs.b || rhs.b;
     }
 }
 
@@ -1,6 +1,15 @@
 #include <cpprealm/scheduler.hpp>
 
 #include <realm/object-store/util/scheduler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <vector>
+
 #ifdef QT_CORE_LIB
 #include <QStandardPaths>
 #include <QMetaObject>
@@ -71,6 +80,345 @@ namespace realm {
         std::shared_ptr<util::Scheduler> m_scheduler = util::Scheduler::make_default();
     };
 
+    namespace internal {
+        namespace {
+            // Multi-producer single-consumer queue (Vyukov). `push` is wait-free,
+            // `pop` may only be called by the owning worker.
+            class mpsc_queue {
+            public:
+                mpsc_queue() : m_head(&m_stub), m_tail(&m_stub) {}
+                mpsc_queue(const mpsc_queue&) = delete;
+                mpsc_queue& operator=(const mpsc_queue&) = delete;
+                ~mpsc_queue() {
+                    while (pop()) {}
+                }
+
+                void push(Function<void()>&& fn) {
+                    auto n = new node;
+                    n->fn = std::move(fn);
+                    push(n);
+                }
+
+                std::optional<Function<void()>> pop() {
+                    node* tail = m_tail;
+                    node* next = tail->next.load(std::memory_order_acquire);
+                    if (tail == &m_stub) {
+                        if (!next)
+                            return std::nullopt;
+                        m_tail = next;
+                        tail = next;
+                        next = next->next.load(std::memory_order_acquire);
+                    }
+                    if (next) {
+                        m_tail = next;
+                        return take(tail);
+                    }
+                    if (tail != m_head.load(std::memory_order_acquire)) {
+                        // A producer has swapped the head but not linked it in yet.
+                        return std::nullopt;
+                    }
+                    push(&m_stub);
+                    next = tail->next.load(std::memory_order_acquire);
+                    if (next) {
+                        m_tail = next;
+                        return take(tail);
+                    }
+                    return std::nullopt;
+                }
+
+            private:
+                struct node {
+                    std::atomic<node*> next = {nullptr};
+                    Function<void()> fn;
+                };
+
+                void push(node* n) {
+                    n->next.store(nullptr, std::memory_order_relaxed);
+                    node* prev = m_head.exchange(n, std::memory_order_acq_rel);
+                    prev->next.store(n, std::memory_order_release);
+                }
+
+                static Function<void()> take(node* n) {
+                    auto fn = std::move(n->fn);
+                    delete n;
+                    return fn;
+                }
+
+                std::atomic<node*> m_head;
+                node* m_tail;
+                node m_stub;
+            };
+
+            struct worker {
+                // Tasks pinned to this worker by `thread_pool_scheduler::invoke`.
+                mpsc_queue inbox;
+                std::atomic<size_t> inbox_size = {0};
+
+                // Unpinned tasks. The owner pops from the back, thieves take from the front.
+                std::mutex deque_mutex;
+                std::deque<Function<void()>> deque;
+
+                std::mutex park_mutex;
+                std::condition_variable park_cv;
+                std::atomic<bool> parked = {false};
+            };
+
+            thread_local const void* t_current_pool = nullptr;
+            thread_local size_t t_current_worker = 0;
+        }
+
+        // State shared between the handle and the worker threads. Workers keep it
+        // alive so that a pool released from one of its own workers can wind down safely.
+        struct thread_pool_state {
+            explicit thread_pool_state(size_t worker_count)
+                : workers(worker_count) {}
+
+            std::vector<worker> workers;
+            std::atomic<size_t> unpinned_size = {0};
+            std::atomic<size_t> next_worker = {0};
+            std::atomic<bool> stop = {false};
+
+            void invoke(size_t idx, Function<void()>&& fn) {
+                auto& w = workers[idx];
+                w.inbox.push(std::move(fn));
+                w.inbox_size.fetch_add(1, std::memory_order_seq_cst);
+                wake(w);
+            }
+
+            void submit(Function<void()>&& fn) {
+                size_t idx = t_current_pool == this ? t_current_worker
+                                                   : next_worker.fetch_add(1, std::memory_order_relaxed) % workers.size();
+                {
+                    std::lock_guard lock(workers[idx].deque_mutex);
+                    workers[idx].deque.push_back(std::move(fn));
+                }
+                unpinned_size.fetch_add(1, std::memory_order_seq_cst);
+                for (auto& w : workers) {
+                    if (w.parked.load(std::memory_order_seq_cst)) {
+                        wake(w);
+                        break;
+                    }
+                }
+            }
+
+            void shutdown() {
+                stop.store(true, std::memory_order_seq_cst);
+                for (auto& w : workers) {
+                    std::lock_guard lock(w.park_mutex);
+                    w.park_cv.notify_one();
+                }
+            }
+
+            void run(size_t idx) {
+                t_current_pool = this;
+                t_current_worker = idx;
+                auto& w = workers[idx];
+                while (true) {
+                    if (auto fn = w.inbox.pop()) {
+                        w.inbox_size.fetch_sub(1, std::memory_order_relaxed);
+                        (*fn)();
+                        continue;
+                    }
+                    if (auto fn = pop_unpinned(idx)) {
+                        unpinned_size.fetch_sub(1, std::memory_order_relaxed);
+                        (*fn)();
+                        continue;
+                    }
+
+                    std::unique_lock lock(w.park_mutex);
+                    w.parked.store(true, std::memory_order_seq_cst);
+                    w.park_cv.wait(lock, [&] {
+                        return stop.load(std::memory_order_seq_cst) ||
+                               w.inbox_size.load(std::memory_order_seq_cst) ||
+                               unpinned_size.load(std::memory_order_seq_cst);
+                    });
+                    w.parked.store(false, std::memory_order_relaxed);
+                    if (stop.load() && !w.inbox_size.load() && !unpinned_size.load()) {
+                        break;
+                    }
+                }
+                t_current_pool = nullptr;
+            }
+
+        private:
+            static void wake(worker& w) {
+                if (w.parked.load(std::memory_order_seq_cst)) {
+                    std::lock_guard lock(w.park_mutex);
+                    w.park_cv.notify_one();
+                }
+            }
+
+            std::optional<Function<void()>> pop_unpinned(size_t idx) {
+                {
+                    auto& w = workers[idx];
+                    std::lock_guard lock(w.deque_mutex);
+                    if (!w.deque.empty()) {
+                        auto fn = std::move(w.deque.back());
+                        w.deque.pop_back();
+                        return fn;
+                    }
+                }
+                for (size_t i = 1; i < workers.size(); ++i) {
+                    auto& victim = workers[(idx + i) % workers.size()];
+                    std::unique_lock lock(victim.deque_mutex, std::try_to_lock);
+                    if (lock && !victim.deque.empty()) {
+                        auto fn = std::move(victim.deque.front());
+                        victim.deque.pop_front();
+                        return fn;
+                    }
+                }
+                return std::nullopt;
+            }
+        };
+
+        struct thread_pool {
+            explicit thread_pool(size_t worker_count)
+                : m_state(std::make_shared<thread_pool_state>(worker_count)) {
+                m_threads.reserve(worker_count);
+                for (size_t i = 0; i < worker_count; ++i) {
+                    m_threads.emplace_back([state = m_state, i] {
+                        state->run(i);
+                    });
+                }
+            }
+
+            ~thread_pool() {
+                m_state->shutdown();
+                for (auto& t : m_threads) {
+                    // The last scheduler may be released by a task running on the pool itself.
+                    if (t.get_id() == std::this_thread::get_id()) {
+                        t.detach();
+                    } else {
+                        t.join();
+                    }
+                }
+            }
+
+            std::shared_ptr<thread_pool_state> m_state;
+            std::vector<std::thread> m_threads;
+        };
+    }
+
+    thread_pool_scheduler::thread_pool_scheduler(size_t worker_count)
+        : m_pool(std::make_shared<internal::thread_pool>(std::max<size_t>(worker_count, 1)))
+        , m_worker_index(0) {}
+
+    thread_pool_scheduler::thread_pool_scheduler(std::shared_ptr<internal::thread_pool> pool, size_t worker_index)
+        : m_pool(std::move(pool)), m_worker_index(worker_index) {}
+
+    thread_pool_scheduler::~thread_pool_scheduler() = default;
+
+    std::shared_ptr<thread_pool_scheduler> thread_pool_scheduler::pin() const {
+        return pin(m_pool->m_state->next_worker.fetch_add(1, std::memory_order_relaxed));
+    }
+
+    std::shared_ptr<thread_pool_scheduler> thread_pool_scheduler::pin(size_t worker_index) const {
+        return std::shared_ptr<thread_pool_scheduler>(new thread_pool_scheduler(m_pool, worker_index % worker_count()));
+    }
+
+    void thread_pool_scheduler::submit(Function<void()> &&fn) {
+        m_pool->m_state->submit(std::move(fn));
+    }
+
+    size_t thread_pool_scheduler::worker_count() const noexcept {
+        return m_pool->m_state->workers.size();
+    }
+
+    size_t thread_pool_scheduler::worker_index() const noexcept {
+        return m_worker_index;
+    }
+
+    void thread_pool_scheduler::invoke(Function<void()> &&fn) {
+        m_pool->m_state->invoke(m_worker_index, std::move(fn));
+    }
+
+    bool thread_pool_scheduler::is_on_thread() const noexcept {
+        return internal::t_current_pool == m_pool->m_state.get() && internal::t_current_worker == m_worker_index;
+    }
+
+    bool thread_pool_scheduler::is_same_as(const scheduler *other) const noexcept {
+        auto o = dynamic_cast<const thread_pool_scheduler *>(other);
+        return o && o->m_pool == m_pool && o->m_worker_index == m_worker_index;
+    }
+
+    bool thread_pool_scheduler::can_invoke() const noexcept {
+        return !m_pool->m_state->stop.load();
+    }
+
+    namespace internal {
+        namespace {
+            // A single thread which hands delayed work to its scheduler once due.
+            // It is never destroyed so that pending work cannot outlive it at exit.
+            class timer_thread {
+            public:
+                static timer_thread& shared() {
+                    static auto* timer = new timer_thread;
+                    return *timer;
+                }
+
+                void schedule(std::chrono::steady_clock::time_point due,
+                              std::shared_ptr<scheduler> s, Function<void()>&& fn) {
+                    {
+                        std::lock_guard lock(m_mutex);
+                        m_entries.push_back({due, m_next_seq++, std::move(s), std::move(fn)});
+                        std::push_heap(m_entries.begin(), m_entries.end(), later);
+                    }
+                    m_cv.notify_one();
+                }
+
+            private:
+                struct entry {
+                    std::chrono::steady_clock::time_point due;
+                    uint64_t seq;
+                    std::shared_ptr<scheduler> target;
+                    Function<void()> fn;
+                };
+
+                static bool later(const entry& a, const entry& b) {
+                    return a.due > b.due || (a.due == b.due && a.seq > b.seq);
+                }
+
+                timer_thread() {
+                    std::thread([this] { run(); }).detach();
+                }
+
+                void run() {
+                    std::unique_lock lock(m_mutex);
+                    while (true) {
+                        if (m_entries.empty()) {
+                            m_cv.wait(lock);
+                            continue;
+                        }
+                        auto due = m_entries.front().due;
+                        if (std::chrono::steady_clock::now() < due) {
+                            m_cv.wait_until(lock, due);
+                            continue;
+                        }
+                        std::pop_heap(m_entries.begin(), m_entries.end(), later);
+                        auto e = std::move(m_entries.back());
+                        m_entries.pop_back();
+                        lock.unlock();
+                        e.target->invoke(std::move(e.fn));
+                        lock.lock();
+                    }
+                }
+
+                std::mutex m_mutex;
+                std::condition_variable m_cv;
+                std::vector<entry> m_entries;
+                uint64_t m_next_seq = 0;
+            };
+        }
+
+        void invoke_after(const std::shared_ptr<scheduler>& s, std::chrono::steady_clock::duration delay, Function<void()>&& fn) {
+            if (delay <= std::chrono::steady_clock::duration::zero()) {
+                s->invoke(std::move(fn));
+                return;
+            }
+            timer_thread::shared().schedule(std::chrono::steady_clock::now() + delay, s, std::move(fn));
+        }
+    }
+
     std::shared_ptr<scheduler> scheduler::make_default() {
 #if QT_CORE_LIB
         util::Scheduler::set_default_factory(make_qt);
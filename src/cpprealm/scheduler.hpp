@@ -1,9 +1,12 @@
 #ifndef CPP_REALM_SCHEDULER_HPP
 #define CPP_REALM_SCHEDULER_HPP
 
+#include <chrono>
 #include <functional>
 #include <future>
+#include <memory>
 #include <queue>
+#include <thread>
 
 namespace realm {
 namespace util {
@@ -14,6 +17,16 @@ namespace util {
 template <typename Fn>
 using Function = util::UniqueFunction<Fn>;
 
+    struct scheduler;
+
+namespace internal {
+    struct thread_pool;
+
+    // Invoke `fn` on the given scheduler once `delay` has elapsed. The delay is
+    // measured by a shared timer thread, so this never blocks the caller.
+    void invoke_after(const std::shared_ptr<scheduler>&, std::chrono::steady_clock::duration delay, Function<void()>&& fn);
+}
+
     struct scheduler {
         static std::shared_ptr<scheduler> make_default();
 
@@ -42,5 +55,47 @@ using Function = util::UniqueFunction<Fn>;
         // This function is not thread-safe.
         [[nodiscard]] virtual bool can_invoke() const noexcept = 0;
     };
+
+    /**
+     A scheduler backed by a fixed pool of worker threads, for processes which
+     have no event loop to deliver notifications on (e.g. server deployments).
+
+     A Realm is confined to the thread it was opened on, so every instance is
+     pinned to exactly one worker of its pool: `invoke` always runs on that worker
+     and `is_on_thread` is only true there. Use `pin` to obtain schedulers for the
+     other workers of the same pool and spread Realms across them.
+
+     Work which is not tied to a Realm can be handed to `submit`. Each worker keeps
+     its own deque of such tasks and idle workers steal from busy ones.
+     */
+    struct thread_pool_scheduler final : public scheduler {
+        // Starts `worker_count` workers. A count of zero is treated as one.
+        explicit thread_pool_scheduler(size_t worker_count = std::thread::hardware_concurrency());
+        ~thread_pool_scheduler() final;
+
+        // Returns a scheduler sharing this pool which is pinned to the next worker, round-robin.
+        [[nodiscard]] std::shared_ptr<thread_pool_scheduler> pin() const;
+        // Returns a scheduler sharing this pool which is pinned to the given worker.
+        [[nodiscard]] std::shared_ptr<thread_pool_scheduler> pin(size_t worker_index) const;
+
+        // Run the given function on whichever worker gets to it first.
+        //
+        // This function can be called from any thread.
+        void submit(Function<void()> &&);
+
+        [[nodiscard]] size_t worker_count() const noexcept;
+        [[nodiscard]] size_t worker_index() const noexcept;
+
+        // Enqueues the function on the pinned worker's inbox. This never takes a
+        // lock unless the worker is parked and has to be woken up.
+        void invoke(Function<void()> &&) override;
+        [[nodiscard]] bool is_on_thread() const noexcept override;
+        bool is_same_as(const scheduler *other) const noexcept override;
+        [[nodiscard]] bool can_invoke() const noexcept override;
+    private:
+        thread_pool_scheduler(std::shared_ptr<internal::thread_pool>, size_t worker_index);
+        std::shared_ptr<internal::thread_pool> m_pool;
+        size_t m_worker_index;
+    };
 }
 #endif //CPP_REALM_SCHEDULER_HPP
@@ -333,6 +333,32 @@ namespace realm {
                 return property_value_for_name<0>(property_name, cls, std::get<0>(properties));
             }
 
+            template<size_t N, typename P>
+            constexpr variant_t
+            property_value_at(size_t index, const experimental::managed<Class, void> &cls, P &property, bool excluding_collections = true) const {
+                if (index == N) {
+                    if (excluding_collections &&
+                        (property.type == realm::internal::bridge::property::type::Array || property.type == realm::internal::bridge::property::type::Dictionary)) {
+                        return variant_t{std::monostate()};
+                    }
+                    auto ptr = experimental::managed<Class, void>::template unmanaged_to_managed_pointer(property.ptr);
+                    if constexpr (std::is_pointer_v<typename P::Result>) {
+                        return (cls.*ptr);
+                    } else {
+                        return (cls.*ptr).detach();
+                    }
+                }
+                if constexpr (N + 1 == sizeof...(Properties)) {
+                    return variant_t{};
+                } else {
+                    return property_value_at<N + 1>(index, cls, std::get<N + 1>(properties), excluding_collections);
+                }
+            }
+            // Like `property_value_for_name`, for the property at `index` in `names`.
+            constexpr auto property_value_at(size_t index, const experimental::managed<Class, void> &cls, bool excluding_collections = true) const {
+                return property_value_at<0>(index, cls, std::get<0>(properties), excluding_collections);
+            }
+
             template<size_t N, typename T, typename P>
             constexpr const char*
             name_for_property(T ptr, P &property) const {
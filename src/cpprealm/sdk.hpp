@@ -49,6 +49,9 @@
 #include <cpprealm/object.hpp>
 #include <cpprealm/app.hpp>
 #include <cpprealm/flex_sync.hpp>
+#include <cpprealm/query_cache.hpp>
+#include <cpprealm/query_profiler.hpp>
+#include <cpprealm/page_cursor.hpp>
 #include <cpprealm/thread_safe_reference.hpp>
 #include <cpprealm/rbool.hpp>
 
@@ -0,0 +1,318 @@
+#ifndef CPP_REALM_TASK_HPP
+#define CPP_REALM_TASK_HPP
+
+#include <cpprealm/scheduler.hpp>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#define CPPREALM_HAVE_COROUTINES 1
+namespace realm::coro {
+    using std::coroutine_handle;
+    using std::noop_coroutine;
+    using std::suspend_always;
+    using std::suspend_never;
+}
+#elif defined(__cpp_coroutines) && __has_include(<experimental/coroutine>)
+#include <experimental/coroutine>
+#define CPPREALM_HAVE_COROUTINES 1
+namespace realm::coro {
+    using std::experimental::coroutine_handle;
+    using std::experimental::noop_coroutine;
+    using std::experimental::suspend_always;
+    using std::experimental::suspend_never;
+}
+#endif
+
+#ifdef CPPREALM_HAVE_COROUTINES
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace realm {
+    namespace internal {
+        // Resume `h` on the given scheduler, or inline when there is none.
+        inline void resume_on(const std::shared_ptr<scheduler>& s, coro::coroutine_handle<> h) {
+            if (s) {
+                s->invoke([h]() mutable { h.resume(); });
+            } else {
+                h.resume();
+            }
+        }
+    }
+
+    /**
+     A lazily started coroutine producing a `T`.
+
+     A task does not run until it is awaited by another coroutine or handed to `spawn`,
+     and it resumes its awaiter directly when it completes, so chains of tasks do not
+     grow the stack. Tasks hold no thread: a single scheduler thread can drive as many
+     of them as it has Realm operations in flight.
+     */
+    template <typename T = void>
+    class task {
+    public:
+        struct promise_type;
+        using handle_type = coro::coroutine_handle<promise_type>;
+
+    private:
+        struct promise_base {
+            coro::coroutine_handle<> continuation;
+            std::exception_ptr error;
+
+            coro::suspend_always initial_suspend() noexcept { return {}; }
+
+            struct final_awaiter {
+                bool await_ready() const noexcept { return false; }
+                template <typename Promise>
+                coro::coroutine_handle<> await_suspend(coro::coroutine_handle<Promise> h) noexcept {
+                    if (auto c = h.promise().continuation) {
+                        return c;
+                    }
+                    return coro::noop_coroutine();
+                }
+                void await_resume() const noexcept {}
+            };
+            final_awaiter final_suspend() noexcept { return {}; }
+
+            void unhandled_exception() noexcept { error = std::current_exception(); }
+        };
+
+    public:
+        struct promise_type : promise_base {
+            std::optional<T> value;
+
+            task get_return_object() { return task(handle_type::from_promise(*this)); }
+
+            template <typename U>
+            void return_value(U&& v) { value.emplace(std::forward<U>(v)); }
+
+            T result() {
+                if (this->error) {
+                    std::rethrow_exception(this->error);
+                }
+                return std::move(*value);
+            }
+        };
+
+        task(task&& other) noexcept : m_handle(std::exchange(other.m_handle, {})) {}
+        task& operator=(task&& other) noexcept {
+            if (this != &other) {
+                if (m_handle) {
+                    m_handle.destroy();
+                }
+                m_handle = std::exchange(other.m_handle, {});
+            }
+            return *this;
+        }
+        task(const task&) = delete;
+        task& operator=(const task&) = delete;
+        ~task() {
+            if (m_handle) {
+                m_handle.destroy();
+            }
+        }
+
+        auto operator co_await() && noexcept {
+            struct awaiter {
+                handle_type h;
+                bool await_ready() const noexcept { return !h || h.done(); }
+                coro::coroutine_handle<> await_suspend(coro::coroutine_handle<> awaiting) noexcept {
+                    h.promise().continuation = awaiting;
+                    return h;
+                }
+                T await_resume() { return h.promise().result(); }
+            };
+            return awaiter{m_handle};
+        }
+
+    private:
+        explicit task(handle_type h) : m_handle(h) {}
+        handle_type m_handle;
+    };
+
+    template <>
+    struct task<void>::promise_type : task<void>::promise_base {
+        task get_return_object() { return task(handle_type::from_promise(*this)); }
+        void return_void() noexcept {}
+        void result() {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    };
+
+    namespace internal {
+        // A coroutine which starts eagerly and frees itself once it finishes.
+        struct detached_task {
+            struct promise_type {
+                detached_task get_return_object() noexcept { return {}; }
+                coro::suspend_never initial_suspend() noexcept { return {}; }
+                coro::suspend_never final_suspend() noexcept { return {}; }
+                void return_void() noexcept {}
+                void unhandled_exception() noexcept { std::terminate(); }
+            };
+        };
+
+        template <typename T>
+        detached_task run_detached(task<T> t, std::promise<T> p) {
+            try {
+                if constexpr (std::is_void_v<T>) {
+                    co_await std::move(t);
+                    p.set_value();
+                } else {
+                    p.set_value(co_await std::move(t));
+                }
+            } catch (...) {
+                p.set_exception(std::current_exception());
+            }
+        }
+    }
+
+    /**
+     Start running `t` on the calling thread until its first suspension point.
+
+     The returned future becomes ready when the task completes; it may be discarded
+     for fire-and-forget work. Tasks awaiting Realm operations are resumed on the Realm's
+     scheduler, so this should be called from that scheduler's thread.
+     */
+    template <typename T>
+    std::future<T> spawn(task<T>&& t) {
+        std::promise<T> p;
+        auto f = p.get_future();
+        internal::run_detached(std::move(t), std::move(p));
+        return f;
+    }
+
+    /**
+     Awaits a single callback-style completion.
+
+     `start` is invoked when the awaiting coroutine suspends and is given a callback which
+     must be called exactly once with the outcome. The coroutine is resumed on `scheduler` if
+     one is given, otherwise on whichever thread calls the callback.
+     */
+    struct completion_awaitable {
+        using completion = std::function<void(std::exception_ptr)>;
+
+        completion_awaitable(std::function<void(completion&&)>&& start,
+                             std::shared_ptr<realm::scheduler> scheduler = nullptr)
+            : m_start(std::move(start)), m_scheduler(std::move(scheduler)) {}
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(coro::coroutine_handle<> h) {
+            m_start([this, h](std::exception_ptr error) {
+                m_error = std::move(error);
+                internal::resume_on(m_scheduler, h);
+            });
+        }
+        void await_resume() const {
+            if (m_error) {
+                std::rethrow_exception(m_error);
+            }
+        }
+
+    private:
+        std::function<void(completion&&)> m_start;
+        std::shared_ptr<scheduler> m_scheduler;
+        std::exception_ptr m_error;
+    };
+
+    /**
+     An asynchronous sequence of values, e.g. the change sets of an observed collection.
+
+     Values are pushed by a producer as they arrive and buffered until a consumer pulls them
+     with `co_await next()`. The consumer is resumed on the scheduler the generator was
+     created with. Destroying the generator stops the producer.
+     */
+    template <typename T>
+    class async_generator {
+    public:
+        struct state {
+            std::mutex mutex;
+            std::deque<T> values;
+            std::exception_ptr error;
+            coro::coroutine_handle<> waiting;
+            std::shared_ptr<realm::scheduler> scheduler;
+
+            void push(T&& value) {
+                coro::coroutine_handle<> h;
+                {
+                    std::lock_guard lock(mutex);
+                    values.push_back(std::move(value));
+                    h = std::exchange(waiting, {});
+                }
+                if (h) {
+                    internal::resume_on(scheduler, h);
+                }
+            }
+
+            void fail(std::exception_ptr err) {
+                coro::coroutine_handle<> h;
+                {
+                    std::lock_guard lock(mutex);
+                    error = std::move(err);
+                    h = std::exchange(waiting, {});
+                }
+                if (h) {
+                    internal::resume_on(scheduler, h);
+                }
+            }
+        };
+
+        template <typename Token>
+        async_generator(std::shared_ptr<state> state, Token&& token)
+            : m_state(std::move(state))
+            , m_token(std::make_shared<std::decay_t<Token>>(std::forward<Token>(token))) {}
+
+        // Suspends until the next value is available. Rethrows the producer's error, if any,
+        // once all values delivered before it have been consumed.
+        auto next() {
+            struct awaiter {
+                state& s;
+                bool await_ready() {
+                    std::lock_guard lock(s.mutex);
+                    return !s.values.empty() || s.error;
+                }
+                bool await_suspend(coro::coroutine_handle<> h) {
+                    std::lock_guard lock(s.mutex);
+                    if (!s.values.empty() || s.error) {
+                        return false;
+                    }
+                    s.waiting = h;
+                    return true;
+                }
+                T await_resume() {
+                    std::lock_guard lock(s.mutex);
+                    if (s.values.empty()) {
+                        std::rethrow_exception(s.error);
+                    }
+                    T value = std::move(s.values.front());
+                    s.values.pop_front();
+                    return value;
+                }
+            };
+            return awaiter{*m_state};
+        }
+
+        // The number of values which have been delivered but not yet consumed.
+        size_t pending() const {
+            std::lock_guard lock(m_state->mutex);
+            return m_state->values.size();
+        }
+
+    private:
+        std::shared_ptr<state> m_state;
+        // Type-erased notification token keeping the producer registered.
+        std::shared_ptr<void> m_token;
+    };
+}
+#endif // CPPREALM_HAVE_COROUTINES
+
+#endif //CPP_REALM_TASK_HPP
@@ -0,0 +1,64 @@
+#include "../../main.hpp"
+#include "test_objects.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// This file is built into its own executable, as it replaces operator new and delete for the
+// whole program to count the bytes allocated and not yet deleted. Each block is prefixed with
+// its size.
+namespace {
+    std::atomic<std::ptrdiff_t> live_allocated_bytes{0};
+    constexpr std::size_t allocation_header = alignof(std::max_align_t);
+}
+
+void* operator new(std::size_t size) {
+    auto block = static_cast<char*>(std::malloc(size + allocation_header));
+    if (!block) {
+        throw std::bad_alloc();
+    }
+    *reinterpret_cast<std::size_t*>(block) = size;
+    live_allocated_bytes += static_cast<std::ptrdiff_t>(size);
+    return block + allocation_header;
+}
+
+void operator delete(void* ptr) noexcept {
+    if (!ptr) {
+        return;
+    }
+    auto block = static_cast<char*>(ptr) - allocation_header;
+    live_allocated_bytes -= static_cast<std::ptrdiff_t>(*reinterpret_cast<std::size_t*>(block));
+    std::free(block);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    operator delete(ptr);
+}
+
+namespace realm::experimental {
+    TEST_CASE("building queries does not leak") {
+        realm_path path;
+        db_config config;
+        config.set_path(path);
+        auto realm = db(std::move(config));
+
+        // Following a link copies and moves the query-mode accessor of the target object.
+        // The queries are only built, not run.
+        auto build = [&realm] {
+            return realm.objects<Person>().where([](auto& p) {
+                return p.dog->name == "Fido" && p.dog->age > 2 && p.name != "John";
+            });
+        };
+        // Lets one-time allocations, such as caches in core, happen before measuring.
+        for (int i = 0; i < 100; i++) {
+            build();
+        }
+        auto before = live_allocated_bytes.load();
+        for (int i = 0; i < 1000000; i++) {
+            build();
+        }
+        CHECK(live_allocated_bytes.load() - before == 0);
+    }
+}
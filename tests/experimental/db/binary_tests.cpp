@@ -221,4 +221,65 @@ TEST_CASE("binary", "[binary]") {
         CHECK(vector == std::vector<uint8_t>({1, 2, 3, 4}));
         CHECK(vector != std::vector<uint8_t>({1, 2, 3}));
     }
+
+    SECTION("streams") {
+        auto realm = realm::experimental::db(std::move(config));
+        auto obj = realm::experimental::AllTypesObject();
+        auto managed_obj = realm.write([&realm, &obj] {
+            return realm.add(std::move(obj));
+        });
+
+        std::vector<uint8_t> payload(10000);
+        for (size_t i = 0; i < payload.size(); i++) {
+            payload[i] = static_cast<uint8_t>(i * 7);
+        }
+
+        realm.write([&] {
+            auto writer = managed_obj.binary_col.open_write();
+            writer.write(payload.data(), 4000);
+            writer.write(payload.data() + 4000, payload.size() - 4000);
+            writer.close();
+        });
+        CHECK(managed_obj.binary_col.size() == payload.size());
+        CHECK(managed_obj.binary_col[300] == payload[300]);
+        CHECK(managed_obj.binary_col[9999] == payload[9999]);
+        CHECK_THROWS_AS(managed_obj.binary_col[10000], std::out_of_range);
+
+        // A writer which is not closed stores nothing.
+        realm.write([&] {
+            auto writer = managed_obj.binary_col.open_write();
+            writer.write(payload.data(), 10);
+        });
+        CHECK(managed_obj.binary_col.size() == payload.size());
+
+        auto reader = managed_obj.binary_col.open_read(9000);
+        CHECK(reader.read(600) == std::vector<uint8_t>(payload.begin() + 9000, payload.begin() + 9600));
+        CHECK(reader.read(600) == std::vector<uint8_t>(payload.begin() + 9600, payload.end()));
+        CHECK(reader.eof());
+        CHECK(reader.read(600).empty());
+
+        // Chunked across the elements of a list.
+        realm.write([&] {
+            auto writer = managed_obj.list_binary_col.open_write(3000);
+            for (size_t i = 0; i < payload.size(); i += 1000) {
+                writer.write(payload.data() + i, 1000);
+            }
+            writer.close();
+            CHECK(writer.size() == payload.size());
+        });
+        CHECK(managed_obj.list_binary_col.size() == 4);
+        CHECK(managed_obj.list_binary_col[3].size() == 1000);
+
+        auto chunk_reader = managed_obj.list_binary_col.open_read();
+        CHECK(chunk_reader.size() == payload.size());
+        std::vector<uint8_t> read_back;
+        while (!chunk_reader.eof()) {
+            auto chunk = chunk_reader.read(1024);
+            read_back.insert(read_back.end(), chunk.begin(), chunk.end());
+        }
+        CHECK(read_back == payload);
+
+        chunk_reader.seek(2999);
+        CHECK(chunk_reader.read(2) == std::vector<uint8_t>{payload[2999], payload[3000]});
+    }
 }
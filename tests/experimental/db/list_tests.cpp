@@ -1,5 +1,7 @@
 #include "../../main.hpp"
 #include "test_objects.hpp"
+#include <array>
+#include <numeric>
 
 using namespace realm;
 
@@ -492,6 +494,157 @@ TEST_CASE("list", "[list]") {
         CHECK(res == std::vector<int64_t>({1, 2, 3}));
     }
 
+    SECTION("iterator random access") {
+        auto realm = realm::experimental::db(std::move(config));
+        auto managed_obj = realm.write([&]() {
+            return realm.add(realm::experimental::AllTypesObject());
+        });
+        // Spans several batches fetched by the iterator.
+        const int64_t count = 2500;
+        realm.write([&]() {
+            for (int64_t i = 0; i < count; i++) {
+                managed_obj.list_int_col.push_back(i);
+            }
+        });
+
+        auto begin = managed_obj.list_int_col.begin();
+        auto end = managed_obj.list_int_col.end();
+        CHECK(end - begin == count);
+        CHECK(std::accumulate(begin, end, int64_t(0)) == count * (count - 1) / 2);
+        CHECK(begin[1500] == 1500);
+        CHECK(*(end - 1) == count - 1);
+        CHECK(*(begin + 1024) == 1024);
+        auto it = begin + 1024;
+        --it;
+        CHECK(*it == 1023);
+        CHECK(begin < it);
+
+        // The cached list accessor sees writes made through the object.
+        realm.write([&]() {
+            managed_obj.list_int_col.clear();
+            managed_obj.list_int_col.push_back(42);
+        });
+        CHECK(managed_obj.list_int_col.size() == 1);
+        CHECK(managed_obj.list_int_col[0] == 42);
+        CHECK(managed_obj.list_int_col.detach() == std::vector<int64_t>{42});
+    }
+
+    SECTION("bulk operations primitive") {
+        auto realm = realm::experimental::db(std::move(config));
+        auto managed_obj = realm.write([&]() {
+            return realm.add(realm::experimental::AllTypesObject());
+        });
+
+        realm.write([&]() {
+            managed_obj.list_int_col.assign(std::vector<int64_t>{1, 2, 3});
+            managed_obj.list_str_col.assign({"a", "b"});
+            managed_obj.list_bool_col.assign(std::vector<bool>{true, false});
+        });
+        CHECK(managed_obj.list_int_col.detach() == std::vector<int64_t>{1, 2, 3});
+        CHECK(managed_obj.list_str_col.detach() == std::vector<std::string>{"a", "b"});
+        CHECK(managed_obj.list_bool_col.detach() == std::vector<bool>{true, false});
+
+        realm.write([&]() {
+            managed_obj.list_int_col.append_range(std::vector<int64_t>{4, 5});
+            managed_obj.list_int_col.insert_range(1, std::array<int64_t, 2>{10, 11});
+            managed_obj.list_str_col.append_range(std::vector<std::string>{"c"});
+            // Assigning replaces the previous contents.
+            managed_obj.list_bool_col.assign(std::vector<bool>{false});
+        });
+        CHECK(managed_obj.list_int_col.detach() == std::vector<int64_t>{1, 10, 11, 2, 3, 4, 5});
+        CHECK(managed_obj.list_str_col.detach() == std::vector<std::string>{"a", "b", "c"});
+        CHECK(managed_obj.list_bool_col.detach() == std::vector<bool>{false});
+
+        realm.write([&]() {
+            managed_obj.list_int_col.resize(2);
+            managed_obj.list_str_col.resize(4);
+        });
+        CHECK(managed_obj.list_int_col.detach() == std::vector<int64_t>{1, 10});
+        CHECK(managed_obj.list_str_col.detach() == std::vector<std::string>{"a", "b", "c", ""});
+    }
+
+    SECTION("bulk operations objects") {
+        auto realm = realm::experimental::db(std::move(config));
+        auto managed_obj = realm.write([&]() {
+            return realm.add(realm::experimental::AllTypesObject());
+        });
+
+        experimental::AllTypesObjectLink link;
+        link._id = 1;
+        link.str_col = "foo";
+        experimental::AllTypesObjectLink link2;
+        link2._id = 2;
+        link2.str_col = "bar";
+
+        realm.write([&]() {
+            managed_obj.list_obj_col.assign(std::vector<experimental::AllTypesObjectLink*>{&link, &link2});
+        });
+        CHECK(managed_obj.list_obj_col.size() == 2);
+        CHECK(managed_obj.list_obj_col[0]->str_col == "foo");
+
+        auto managed_link = realm.objects<experimental::AllTypesObjectLink>()[1];
+        realm.write([&]() {
+            managed_obj.list_obj_col.insert_range(0, std::vector<experimental::managed<experimental::AllTypesObjectLink>>{managed_link});
+            managed_obj.list_obj_col.resize(2);
+        });
+        CHECK(managed_obj.list_obj_col.size() == 2);
+        CHECK(managed_obj.list_obj_col[0]->str_col == "bar");
+        CHECK(managed_obj.list_obj_col[1]->str_col == "foo");
+        CHECK_THROWS(managed_obj.list_obj_col.resize(3));
+    }
+
+    SECTION("link list column plan and prefetch") {
+        auto realm = realm::experimental::db(std::move(config));
+        auto managed_obj = realm.write([&]() {
+            return realm.add(realm::experimental::AllTypesObject());
+        });
+
+        std::vector<experimental::AllTypesObjectLink> links(50);
+        std::vector<experimental::AllTypesObjectLink*> link_ptrs;
+        for (size_t i = 0; i < links.size(); i++) {
+            links[i]._id = static_cast<int64_t>(i);
+            links[i].str_col = "link " + std::to_string(i);
+            link_ptrs.push_back(&links[i]);
+        }
+        // Each object reads its own link, rather than the one cached by the previous object.
+        experimental::StringObject first_target, second_target;
+        first_target._id = 1;
+        first_target.str_col = "first";
+        second_target._id = 2;
+        second_target.str_col = "second";
+        links[0].str_link_col = &first_target;
+        links[1].str_link_col = &second_target;
+        realm.write([&]() {
+            managed_obj.list_obj_col.assign(link_ptrs);
+        });
+
+        size_t i = 0;
+        for (auto link : managed_obj.list_obj_col) {
+            CHECK(link.str_col == "link " + std::to_string(i++));
+        }
+        CHECK(i == 50);
+        CHECK(managed_obj.list_obj_col[49]->str_col == "link 49");
+
+        auto rows = managed_obj.list_obj_col.prefetch(&experimental::AllTypesObjectLink::str_col,
+                                                      &experimental::AllTypesObjectLink::_id);
+        REQUIRE(rows.size() == 50);
+        CHECK(std::get<0>(rows[10]) == "link 10");
+        CHECK(std::get<1>(rows[10]).value == 10);
+
+        auto detached = managed_obj.list_obj_col.detach();
+        REQUIRE(detached.size() == 50);
+        CHECK(detached[20]->str_col == "link 20");
+        REQUIRE(detached[0]->str_link_col);
+        REQUIRE(detached[1]->str_link_col);
+        CHECK(detached[0]->str_link_col->str_col == "first");
+        CHECK(detached[1]->str_link_col->str_col == "second");
+        CHECK_FALSE(detached[2]->str_link_col);
+        for (auto* link : detached) {
+            delete link->str_link_col;
+            delete link;
+        }
+    }
+
     SECTION("iterator managed objects") {
         auto realm = realm::experimental::db(std::move(config));
         auto obj = realm::experimental::AllTypesObject();
@@ -160,6 +160,46 @@ TEST_CASE("map", "[map]") {
         }
     }
 
+    SECTION("managed_map_observe_keys_and_ranges") {
+        auto obj = experimental::AllTypesObject();
+        obj.map_str_col = {
+                {"a", std::string("foo")},
+                {"c", std::string("bar")}
+        };
+        auto realm = experimental::db(std::move(config));
+        auto managed_obj = realm.write([&realm, &obj] {
+            return realm.add(std::move(obj));
+        });
+
+        std::vector<std::string> insertions, modifications, deletions;
+        auto key_token = managed_obj.map_str_col.observe_keys([&](realm::dictionary_key_change change) {
+            for (auto key : change.insertions) insertions.emplace_back(key);
+            for (auto key : change.modifications) modifications.emplace_back(key);
+            for (auto key : change.deletions) deletions.emplace_back(key);
+        });
+        size_t inserted = 0, modified = 0, deleted = 0;
+        auto range_token = managed_obj.map_str_col.observe_ranges([&](experimental::collection_range_change change) {
+            inserted += change.insertions.count();
+            modified += change.modifications.count();
+            deleted += change.deletions.count();
+        });
+        realm.refresh();
+
+        realm.write([&managed_obj] {
+            managed_obj.map_str_col["a"] = "baz";
+            managed_obj.map_str_col["b"] = "food";
+            managed_obj.map_str_col.erase("c");
+        });
+        realm.refresh();
+
+        CHECK(insertions == std::vector<std::string>{"b"});
+        CHECK(modifications == std::vector<std::string>{"a"});
+        CHECK(deletions == std::vector<std::string>{"c"});
+        CHECK(inserted == 1);
+        CHECK(modified == 1);
+        CHECK(deleted == 1);
+    }
+
     SECTION("find_erase") {
         auto obj = experimental::AllTypesObject();
         obj.map_str_col = {
@@ -207,4 +247,47 @@ TEST_CASE("map", "[map]") {
         std::map<std::string, std::string> as_values = managed_obj.map_str_col.detach();
         CHECK(as_values == std::map<std::string, std::string>({{"a", std::string("baz")}, {"b", std::string("foo")}}));
     }
+
+    SECTION("string_view_lookup_and_batches") {
+        auto obj = experimental::AllTypesObject();
+        obj.map_int_col = {
+                {"a", 1},
+                {"b", 2}
+        };
+
+        auto realm = experimental::db(std::move(config));
+        auto managed_obj = realm.write([&realm, &obj] {
+            return realm.add(std::move(obj));
+        });
+
+        std::string_view key = "a";
+        CHECK(managed_obj.map_int_col.contains(key));
+        CHECK_FALSE(managed_obj.map_int_col.contains("z"));
+        CHECK(managed_obj.map_int_col.get(key) == 1);
+        CHECK(managed_obj.map_int_col.get("z") == std::nullopt);
+        CHECK(managed_obj.map_int_col[key] == 1);
+
+        auto values = managed_obj.map_int_col.get_many({"b", "z", "a"});
+        CHECK(values == std::vector<std::optional<int64_t>>{2, std::nullopt, 1});
+        std::vector<std::string> owned_keys = {"a", "b"};
+        CHECK(managed_obj.map_int_col.get_many(owned_keys) == std::vector<std::optional<int64_t>>{1, 2});
+
+        realm.write([&managed_obj] {
+            managed_obj.map_int_col.insert_many({{"b", 20}, {"c", 3}});
+            managed_obj.map_int_col.insert_many(std::map<std::string, int64_t>{{"d", 4}, {"e", 5}});
+        });
+        CHECK(managed_obj.map_int_col.size() == 5);
+        CHECK(managed_obj.map_int_col.detach() == std::map<std::string, int64_t>{{"a", 1}, {"b", 20}, {"c", 3}, {"d", 4}, {"e", 5}});
+
+        std::map<std::string, int64_t> streamed;
+        for (auto [k, v] : managed_obj.map_int_col.entries()) {
+            streamed.emplace(k, v);
+        }
+        CHECK(streamed == managed_obj.map_int_col.detach());
+
+        realm.write([&managed_obj] {
+            managed_obj.map_str_col.insert_many({{"x", std::string("foo")}, {"y", std::string("bar")}});
+        });
+        CHECK(managed_obj.map_str_col.get_many({"y", "x"}) == std::vector<std::optional<std::string>>{std::string("bar"), std::string("foo")});
+    }
 }
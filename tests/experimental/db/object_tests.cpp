@@ -668,6 +668,36 @@ namespace realm::experimental {
             CHECK(run_count == 2);
         }
 
+        SECTION("object_notifications_keypath") {
+            experimental::db realm = experimental::open(path);
+
+            auto managed_foo = realm.write([&realm]() {
+                return realm.add(AllTypesObject());
+            });
+
+            int run_count = 0;
+            std::vector<std::string> changed_names;
+            auto token = managed_foo.observe([&](auto&& change) {
+                for (auto& prop_change : change.property_changes) {
+                    changed_names.push_back(prop_change.name);
+                }
+                run_count++;
+            }, {&AllTypesObject::str_col, &AllTypesObject::bool_col});
+
+            realm.write([&managed_foo] {
+                managed_foo.int_col = 42;
+            });
+            realm.refresh();
+            CHECK(run_count == 0);
+
+            realm.write([&managed_foo] {
+                managed_foo.str_col = "foo";
+            });
+            realm.refresh();
+            CHECK(run_count == 1);
+            CHECK(changed_names == std::vector<std::string>{"str_col"});
+        }
+
         SECTION("optional objects") {
             auto realm = db(std::move(config));
 
@@ -734,6 +764,48 @@ namespace realm::experimental {
             CHECK(realm.objects<experimental::Dog>()[0].owners.size() == 0);
         }
 
+        SECTION("backlinks cached view and count") {
+            auto realm = db(std::move(config));
+            experimental::Dog dog;
+            dog._id = 0;
+            dog.name = "fido";
+
+            auto [jack, jill] = realm.write([&realm, &dog]() {
+                experimental::Person person;
+                person._id = 0;
+                person.name = "Jack";
+                person.dog = &dog;
+                experimental::Person person2;
+                person2._id = 1;
+                person2.name = "Jill";
+                person2.dog = nullptr;
+                return realm.insert(std::move(person), std::move(person2));
+            });
+
+            auto managed_dog = realm.objects<experimental::Dog>()[0];
+            CHECK(managed_dog.owners.count() == 1);
+            CHECK(managed_dog.owners.size() == 1);
+            CHECK(managed_dog.owners[0].name == "Jack");
+
+            // The same accessor picks up changes made in later versions.
+            realm.write([&jill, &managed_dog]() {
+                jill.dog = managed_dog;
+            });
+            CHECK(managed_dog.owners.count() == 2);
+            CHECK(managed_dog.owners.size() == 2);
+            std::set<std::string> names;
+            for (auto owner : managed_dog.owners) {
+                names.insert(owner.name.detach());
+            }
+            CHECK(names == std::set<std::string>{"Jack", "Jill"});
+
+            realm.write([&realm, &jack]() {
+                realm.remove(jack);
+            });
+            CHECK(managed_dog.owners.count() == 1);
+            CHECK(managed_dog.owners.size() == 1);
+        }
+
         SECTION("assign link") {
             AllTypesObject obj;
             obj._id = 1;
@@ -813,6 +885,48 @@ namespace realm::experimental {
             CHECK(managed_obj.map_link_col["bar"] == managed_link2);
         }
 
+        SECTION("chained link traversal") {
+            AllTypesObject obj;
+            obj._id = 1;
+            AllTypesObjectLink link;
+            link._id = 1;
+            link.str_col = "link";
+            StringObject str_obj;
+            str_obj._id = 1;
+            str_obj.str_col = "foo";
+            link.str_link_col = &str_obj;
+            obj.opt_obj_col = &link;
+
+            experimental::db db = experimental::open(path);
+            auto managed_obj = db.write([&]() {
+                return db.add(std::move(obj));
+            });
+
+            CHECK(managed_obj.opt_obj_col->str_col == "link");
+            CHECK(managed_obj.opt_obj_col->str_link_col->str_col == "foo");
+            // The same accessor is reused while the link is unchanged.
+            CHECK(managed_obj.opt_obj_col.operator->() == managed_obj.opt_obj_col.operator->());
+
+            AllTypesObjectLink link2;
+            link2._id = 2;
+            link2.str_col = "link2";
+            db.write([&]() {
+                managed_obj.opt_obj_col->str_link_col->str_col = "bar";
+                managed_obj.opt_obj_col = db.add(std::move(link2));
+            });
+            CHECK(managed_obj.opt_obj_col->str_col == "link2");
+            CHECK(managed_obj.opt_obj_col->str_link_col == nullptr);
+            CHECK(db.objects<StringObject>()[0].str_col == "bar");
+
+            auto copy = managed_obj;
+            CHECK(copy.opt_obj_col->str_col == "link2");
+            db.write([&]() {
+                managed_obj.opt_obj_col = nullptr;
+            });
+            CHECK(copy.opt_obj_col == nullptr);
+            CHECK_FALSE(copy.opt_obj_col);
+        }
+
         SECTION("null bool operator") {
             AllTypesObject obj;
             obj._id = 1;
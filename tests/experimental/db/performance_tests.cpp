@@ -87,3 +87,403 @@ TEST_CASE("basic_beta_performance", "[performance]") {
         });
     };
 }
+
+TEST_CASE("thread_pool_scheduler_performance", "[performance]") {
+    BENCHMARK_ADVANCED("invoke 100000 across 4 workers")(Catch::Benchmark::Chronometer meter) {
+        auto pool = std::make_shared<thread_pool_scheduler>(4);
+        std::vector<std::shared_ptr<thread_pool_scheduler>> workers;
+        for (size_t i = 0; i < pool->worker_count(); i++) {
+            workers.push_back(pool->pin(i));
+        }
+
+        return meter.measure([&]() {
+            std::atomic<size_t> remaining = 100000;
+            std::promise<void> done;
+            for (size_t i = 0; i < 100000; i++) {
+                workers[i % workers.size()]->invoke([&] {
+                    if (remaining.fetch_sub(1) == 1) {
+                        done.set_value();
+                    }
+                });
+            }
+            done.get_future().wait();
+        });
+    };
+
+    BENCHMARK_ADVANCED("notifications for 1000 writes")(Catch::Benchmark::Chronometer meter) {
+        realm_path path;
+        auto pool = std::make_shared<thread_pool_scheduler>(2);
+        auto scheduler = pool->pin();
+
+        std::optional<experimental::db> observed_realm;
+        std::optional<experimental::results<experimental::AllTypesObject>> results;
+        internal::bridge::notification_token token;
+        std::atomic<size_t> delivered = 0;
+
+        std::promise<void> opened;
+        scheduler->invoke([&] {
+            observed_realm.emplace(db_config(path, scheduler));
+            results.emplace(observed_realm->objects<experimental::AllTypesObject>());
+            token = results->observe([&](auto&& change) {
+                delivered += change.insertions.size();
+            });
+            opened.set_value();
+        });
+        opened.get_future().wait();
+
+        db_config config;
+        config.set_path(path);
+        auto realm = experimental::db(std::move(config));
+        int64_t next_id = 0;
+
+        meter.measure([&]() {
+            auto target = delivered.load() + 1000;
+            for (int64_t i = 0; i < 1000; i++) {
+                realm.write([&] {
+                    experimental::AllTypesObject o;
+                    o._id = next_id++;
+                    realm.add(std::move(o));
+                });
+            }
+            while (delivered.load() < target) {
+                std::this_thread::yield();
+            }
+        });
+
+        std::promise<void> closed;
+        scheduler->invoke([&] {
+            token.unregister();
+            results.reset();
+            observed_realm.reset();
+            closed.set_value();
+        });
+        closed.get_future().wait();
+    };
+}
+
+TEST_CASE("list_performance", "[performance]") {
+    realm_path path;
+    realm::db_config config;
+    config.set_path(path);
+    auto realm = experimental::db(std::move(config));
+    auto managed_obj = realm.write([&realm] {
+        return realm.add(experimental::AllTypesObject());
+    });
+    realm.write([&] {
+        for (int64_t i = 0; i < 100000; i++) {
+            managed_obj.list_int_col.push_back(i);
+            managed_obj.list_str_col.push_back(std::to_string(i));
+        }
+    });
+
+    BENCHMARK_ADVANCED("iterate 100000 ints")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            int64_t sum = 0;
+            for (auto v : managed_obj.list_int_col) {
+                sum += v;
+            }
+            return sum;
+        });
+    };
+
+    BENCHMARK_ADVANCED("iterate 100000 strings")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            size_t length = 0;
+            for (auto v : managed_obj.list_str_col) {
+                length += v.size();
+            }
+            return length;
+        });
+    };
+
+    BENCHMARK_ADVANCED("subscript 100000 ints")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            int64_t sum = 0;
+            for (size_t i = 0; i < 100000; i++) {
+                sum += managed_obj.list_int_col[i];
+            }
+            return sum;
+        });
+    };
+
+    BENCHMARK_ADVANCED("detach 100000 ints")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            return managed_obj.list_int_col.detach().size();
+        });
+    };
+}
+
+TEST_CASE("list_bulk_performance", "[performance]") {
+    std::vector<double> samples;
+    for (int i = 0; i < 10000; i++) {
+        samples.push_back(i * 0.5);
+    }
+
+    BENCHMARK_ADVANCED("push_back 10000 doubles")(Catch::Benchmark::Chronometer meter) {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        auto realm = experimental::db(std::move(config));
+        auto managed_obj = realm.write([&realm] {
+            return realm.add(experimental::AllTypesObject());
+        });
+
+        return meter.measure([&]() {
+            realm.write([&] {
+                managed_obj.list_double_col.clear();
+                for (auto& sample : samples) {
+                    managed_obj.list_double_col.push_back(sample);
+                }
+            });
+        });
+    };
+
+    BENCHMARK_ADVANCED("assign 10000 doubles")(Catch::Benchmark::Chronometer meter) {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        auto realm = experimental::db(std::move(config));
+        auto managed_obj = realm.write([&realm] {
+            return realm.add(experimental::AllTypesObject());
+        });
+
+        return meter.measure([&]() {
+            realm.write([&] {
+                managed_obj.list_double_col.assign(samples);
+            });
+        });
+    };
+}
+
+TEST_CASE("prepared_query_performance", "[performance]") {
+    realm_path path;
+    realm::db_config config;
+    config.set_path(path);
+    auto realm = experimental::db(std::move(config));
+    realm.write([&] {
+        for (int64_t i = 0; i < 1000; i++) {
+            experimental::AllTypesObject o;
+            o._id = i;
+            o.str_col = std::to_string(i % 10);
+            realm.add(std::move(o));
+        }
+    });
+
+    BENCHMARK_ADVANCED("where 1000 times")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            size_t count = 0;
+            for (int64_t i = 0; i < 1000; i++) {
+                count += realm.objects<experimental::AllTypesObject>().where([i](auto& o) {
+                    return o._id >= i && o.str_col == "1";
+                }).size();
+            }
+            return count;
+        });
+    };
+
+    BENCHMARK_ADVANCED("prepare once")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            return realm.objects<experimental::AllTypesObject>().prepare<int64_t>([](auto& o, int64_t id) {
+                return o._id >= id && o.str_col == "1";
+            });
+        });
+    };
+
+    BENCHMARK_ADVANCED("execute prepared 1000 times")(Catch::Benchmark::Chronometer meter) {
+        auto query = realm.objects<experimental::AllTypesObject>().prepare<int64_t>([](auto& o, int64_t id) {
+            return o._id >= id && o.str_col == "1";
+        });
+        return meter.measure([&]() {
+            size_t count = 0;
+            for (int64_t i = 0; i < 1000; i++) {
+                count += query.execute(i).size();
+            }
+            return count;
+        });
+    };
+}
+
+TEST_CASE("in_query_performance", "[performance]") {
+    realm_path path;
+    realm::db_config config;
+    config.set_path(path);
+    auto realm = experimental::db(std::move(config));
+    realm.write([&] {
+        for (int64_t i = 0; i < 10000; i++) {
+            experimental::AllTypesObject o;
+            o._id = i;
+            o.int_col = i;
+            realm.add(std::move(o));
+        }
+    });
+    std::vector<int64_t> values;
+    for (int64_t i = 0; i < 500; i++) {
+        values.push_back(i * 20);
+    }
+
+    BENCHMARK_ADVANCED("|| chain of 500 values")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            return realm.objects<experimental::AllTypesObject>().where([&values](auto& o) {
+                std::optional<rbool> r;
+                for (auto v : values) {
+                    r.emplace(r ? *r || o.int_col == v : o.int_col == v);
+                }
+                return *r;
+            }).size();
+        });
+    };
+
+    BENCHMARK_ADVANCED("in() with 500 values")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            return realm.objects<experimental::AllTypesObject>().where([&values](auto& o) {
+                return o.int_col.in(values);
+            }).size();
+        });
+    };
+
+    BENCHMARK_ADVANCED("in() on the primary key with 500 values")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            return realm.objects<experimental::AllTypesObject>().where([&values](auto& o) {
+                return o._id.in(values);
+            }).size();
+        });
+    };
+}
+
+TEST_CASE("keyset_pagination_performance", "[performance]") {
+    realm_path path;
+    realm::db_config config;
+    config.set_path(path);
+    auto realm = experimental::db(std::move(config));
+    realm.write([&] {
+        for (int64_t i = 0; i < 100000; i++) {
+            experimental::AllTypesObject o;
+            o._id = i;
+            o.int_col = i / 10;
+            realm.add(std::move(o));
+        }
+    });
+    auto sorted = realm.objects<experimental::AllTypesObject>().sorted_by(&experimental::AllTypesObject::int_col);
+    auto deep_cursor = [&] {
+        auto page = sorted.take(99900);
+        return *page.next_cursor();
+    }();
+
+    BENCHMARK_ADVANCED("first page of 100")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            return sorted.take(100)[99]._id.detach().value;
+        });
+    };
+
+    BENCHMARK_ADVANCED("page of 100 after 99900 objects")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            return sorted.after(deep_cursor).take(100)[99]._id.detach().value;
+        });
+    };
+
+    BENCHMARK_ADVANCED("page of 100 at offset 99900")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            // Sorts every object to skip to the offset.
+            auto results = sorted.take(100000);
+            int64_t last = 0;
+            for (size_t i = 99900; i < 100000; i++) {
+                last = results[i]._id.detach().value;
+            }
+            return last;
+        });
+    };
+}
+
+TEST_CASE("geospatial_query_performance", "[performance]") {
+    realm_path path;
+    realm::db_config config;
+    config.set_path(path);
+    auto realm = experimental::db(std::move(config));
+    realm.write([&] {
+        for (int64_t i = 0; i < 10000; i++) {
+            experimental::geo_point location(-74.0 + static_cast<double>(i % 100) * 0.001,
+                                             40.70 + static_cast<double>(i / 100) * 0.001);
+            experimental::Venue venue;
+            venue._id = i;
+            venue.location = &location;
+            realm.add(std::move(venue));
+        }
+    });
+    auto center = experimental::geo_point(-73.95, 40.75);
+
+    BENCHMARK_ADVANCED("geo_within a circle")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            return realm.objects<experimental::Venue>().where([&center](auto& v) {
+                return v.location.geo_within(experimental::geo_circle::from_kilometers(center, 1));
+            }).size();
+        });
+    };
+
+    BENCHMARK_ADVANCED("detaching every location")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            size_t matches = 0;
+            auto circle = experimental::geo_circle::from_kilometers(center, 1);
+            for (auto& venue : realm.objects<experimental::Venue>()) {
+                matches += venue.location.geo_within(circle) ? 1 : 0;
+            }
+            return matches;
+        });
+    };
+}
+
+TEST_CASE("bulk_update_performance", "[performance]") {
+    realm_path path;
+    realm::db_config config;
+    config.set_path(path);
+    auto realm = experimental::db(std::move(config));
+    realm.write([&] {
+        for (int64_t i = 0; i < 1000000; i++) {
+            experimental::Person p;
+            p._id = i;
+            p.age = i % 100;
+            p.dog = nullptr;
+            realm.add(std::move(p));
+        }
+    });
+    auto people = realm.objects<experimental::Person>();
+    int64_t age = 0;
+
+    BENCHMARK_ADVANCED("set_all on 1M objects")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            realm.write([&] {
+                people.set_all(&experimental::Person::age, ++age);
+            });
+        });
+    };
+
+    BENCHMARK_ADVANCED("assigning each of 1M objects")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            realm.write([&] {
+                ++age;
+                for (auto& p : people) {
+                    p.age = age;
+                }
+            });
+        });
+    };
+
+    // The deletions are rolled back so that each run deletes every object.
+    BENCHMARK_ADVANCED("remove_all on 1M objects")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            realm.begin_write();
+            people.remove_all();
+            realm.m_realm.cancel_transaction();
+        });
+    };
+
+    BENCHMARK_ADVANCED("removing each of 1M objects")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            realm.begin_write();
+            for (size_t i = people.size(); i > 0; i--) {
+                auto p = people[i - 1];
+                realm.remove(p);
+            }
+            realm.m_realm.cancel_transaction();
+        });
+    };
+}
@@ -1,6 +1,8 @@
 #include "../../main.hpp"
 #include "test_objects.hpp"
 
+#include <realm/util/logger.hpp>
+
 namespace realm::experimental {
 
 #define query_results_size(Cls, fn)  \
@@ -224,5 +226,462 @@ namespace realm::experimental {
             });
             CHECK(res.size() == 0);
         }
+
+        SECTION("prepared_query") {
+            auto realm = db(std::move(config));
+
+            realm.write([&]() {
+                for (int64_t i = 0; i < 10; i++) {
+                    AllTypesObject obj;
+                    obj._id = i;
+                    obj.str_col = i % 2 == 0 ? "even" : "odd";
+                    realm.add(std::move(obj));
+                }
+            });
+
+            auto query = realm.objects<AllTypesObject>().prepare<int64_t, std::string>([](auto &o, int64_t id, const std::string& str) {
+                return o._id >= id && o.str_col == str;
+            });
+            CHECK(query.execute(0, "even").size() == 5);
+            CHECK(query.execute(5, "even").size() == 2);
+            CHECK(query.execute(5, "odd").size() == 3);
+            CHECK(query.execute(5, "odd").size() == 3);
+            CHECK(query.execute(10, "odd").size() == 0);
+
+            auto results = query.execute(8, "even");
+            CHECK(results[0]._id == 8);
+
+            // Executions see objects written after the query was prepared.
+            realm.write([&]() {
+                AllTypesObject obj;
+                obj._id = 10;
+                obj.str_col = "even";
+                realm.add(std::move(obj));
+            });
+            CHECK(query.execute(8, "even").size() == 2);
+        }
+
+        SECTION("string query cache") {
+            auto realm = db(std::move(config));
+            realm.write([&]() {
+                for (int64_t i = 0; i < 10; i++) {
+                    AllTypesObject obj;
+                    obj._id = i;
+                    obj.str_col = i % 2 == 0 ? "even" : "odd";
+                    realm.add(std::move(obj));
+                }
+            });
+
+            clear_query_cache();
+            set_query_cache_capacity(2);
+            std::string even = "even";
+            std::string odd = "odd";
+            CHECK(realm.objects<AllTypesObject>().where("_id >= $0 && str_col == $1", {0, internal::bridge::mixed(even)}).size() == 5);
+            CHECK(realm.objects<AllTypesObject>().where("_id >= $0 && str_col == $1", {5, internal::bridge::mixed(odd)}).size() == 3);
+            CHECK(realm.objects<AllTypesObject>().where("_id >= $0 && str_col == $1", {10, internal::bridge::mixed(odd)}).size() == 0);
+            auto stats = get_query_cache_stats();
+            CHECK(stats.misses == 1);
+            CHECK(stats.hits == 2);
+            CHECK(stats.size == 1);
+            CHECK(stats.capacity == 2);
+
+            CHECK(realm.objects<AllTypesObject>().where("_id < $0", {3}).size() == 3);
+            CHECK(realm.objects<AllTypesObject>().where("str_col == $0", {internal::bridge::mixed(odd)}).size() == 5);
+            stats = get_query_cache_stats();
+            CHECK(stats.misses == 3);
+            CHECK(stats.evictions == 1);
+            CHECK(stats.size == 2);
+
+            // Queries which fail to parse are not cached.
+            CHECK_THROWS(realm.objects<AllTypesObject>().where("_id <<< $0", {3}));
+            CHECK(get_query_cache_stats().size == 2);
+
+            set_query_cache_capacity(0);
+            CHECK(get_query_cache_stats().size == 0);
+            CHECK(realm.objects<AllTypesObject>().where("_id < $0", {3}).size() == 3);
+            CHECK(get_query_cache_stats().hits == 2);
+            set_query_cache_capacity(64);
+            clear_query_cache();
+        }
+
+        SECTION("combined comparisons") {
+            auto realm = db(std::move(config));
+            realm.write([&]() {
+                for (int64_t i = 0; i < 20; i++) {
+                    AllTypesObject obj;
+                    obj._id = i;
+                    obj.int_col = i;
+                    obj.double_col = i * 0.5;
+                    obj.str_col = std::to_string(i % 4);
+                    realm.add(std::move(obj));
+                }
+            });
+
+            auto count = [&realm](std::function<rbool(managed<AllTypesObject>&)>&& fn) {
+                return realm.objects<AllTypesObject>().where(std::move(fn)).size();
+            };
+
+            // Disjunctions of equalities on one column.
+            CHECK(count([](auto& o) { return o.int_col == 1 || o.int_col == 3 || o.int_col == 5 || o.int_col == 100; }) == 3);
+            CHECK(count([](auto& o) { return o.str_col == "1" || o.str_col == "2"; }) == 10);
+            CHECK(count([](auto& o) { return (o.int_col == 1 || o.int_col == 2) || (o.int_col == 3 || o.str_col == "0"); }) == 8);
+            CHECK(count([](auto& o) { return !(o.int_col == 1 || o.int_col == 2); }) == 18);
+            CHECK(count([](auto& o) { return (o.int_col == 1 || o.int_col == 2) && o.str_col == "2"; }) == 1);
+
+            // Ranges on one column.
+            CHECK(count([](auto& o) { return o.int_col >= 5 && o.int_col <= 9; }) == 5);
+            CHECK(count([](auto& o) { return o.int_col > 5 && o.int_col < 9; }) == 3);
+            CHECK(count([](auto& o) { return o.int_col > 5 && o.str_col == "2" && o.int_col < 15; }) == 3);
+            CHECK(count([](auto& o) { return o.int_col <= 9 && o.int_col >= 5 && o.int_col >= 7; }) == 3);
+            CHECK(count([](auto& o) { return o.int_col >= 9 && o.int_col <= 5; }) == 0);
+            CHECK(count([](auto& o) { return o.double_col >= 1.0 && o.double_col <= 2.0; }) == 3);
+            CHECK(count([](auto& o) { return o.double_col > 1.0 && o.double_col < 2.0; }) == 1);
+            CHECK(count([](auto& o) { return o.int_col >= 5 && o.double_col <= 3.0; }) == 2);
+            CHECK(count([](auto& o) { return o.int_col > std::numeric_limits<int64_t>::max() - 1 && o.int_col < 3; }) == 0);
+
+            // Outside of queries
+            auto obj = realm.objects<AllTypesObject>()[1];
+            CHECK((obj.int_col == 1 || obj.int_col == 2));
+            CHECK_FALSE((obj.int_col == 1 && obj.int_col == 2));
+        }
+
+        SECTION("in") {
+            auto realm = db(std::move(config));
+            std::vector<realm::uuid> uuids;
+            std::vector<realm::object_id> object_ids;
+            realm.write([&]() {
+                for (int64_t i = 0; i < 10; i++) {
+                    AllTypesObject obj;
+                    obj._id = i;
+                    obj.int_col = i * 10;
+                    obj.str_col = "str_" + std::to_string(i);
+                    obj.enum_col = i % 2 ? AllTypesObject::Enum::two : AllTypesObject::Enum::one;
+                    obj.uuid_col = realm::uuid("18de7916-7f84-11ec-a8a3-0242ac12000" + std::to_string(i));
+                    obj.object_id_col = realm::object_id::generate();
+                    uuids.push_back(obj.uuid_col);
+                    object_ids.push_back(obj.object_id_col);
+                    realm.add(std::move(obj));
+                }
+            });
+
+            auto count = [&realm](std::function<rbool(managed<AllTypesObject>&)>&& fn) {
+                return realm.objects<AllTypesObject>().where(std::move(fn)).size();
+            };
+
+            CHECK(count([](auto& o) { return o.int_col.in({10, 30, 35, 90}); }) == 3);
+            std::vector<int> ints = {0, 20};
+            CHECK(count([&ints](auto& o) { return o.int_col.in(ints); }) == 2);
+            CHECK(count([](auto& o) { return o._id.in({1, 2, 3, 42}); }) == 3);
+            CHECK(count([](auto& o) { return o.int_col.in(std::vector<int64_t>()); }) == 0);
+            CHECK(count([](auto& o) { return o.str_col.in({"str_1", "str_4", "str"}); }) == 2);
+            std::set<std::string> strings = {"str_7", "str_8"};
+            CHECK(count([&strings](auto& o) { return o.str_col.in(strings) && o.int_col > 70; }) == 1);
+            CHECK(count([](auto& o) { return o.enum_col.in({AllTypesObject::Enum::two}); }) == 5);
+            CHECK(count([](auto& o) { return o.enum_col.in({AllTypesObject::Enum::one, AllTypesObject::Enum::two}); }) == 10);
+            CHECK(count([&uuids](auto& o) { return o.uuid_col.in(std::vector<realm::uuid>(uuids.begin(), uuids.begin() + 4)); }) == 4);
+            CHECK(count([&object_ids](auto& o) { return o.object_id_col.in({object_ids[2], object_ids[9], realm::object_id::generate()}); }) == 2);
+            CHECK(count([](auto& o) { return !o.int_col.in({0, 10}); }) == 8);
+
+            // Query strings with a list argument
+            std::vector<int64_t> ids = {1, 5, 9, 11};
+            CHECK(realm.objects<AllTypesObject>().where("_id IN $0", {ids}).size() == 3);
+            CHECK(realm.objects<AllTypesObject>().where("_id IN $0 && int_col > $1", {ids, 10}).size() == 2);
+            // A vector of single values, as taken before list arguments were supported.
+            std::vector<internal::bridge::mixed> single_values{int64_t(1), int64_t(10)};
+            CHECK(realm.objects<AllTypesObject>().where("_id > $0 && int_col > $1", single_values).size() == 8);
+            std::vector<std::string> names = {"str_0", "str_3"};
+            CHECK(realm.objects<AllTypesObject>().where("str_col IN $0", {names}).size() == 2);
+            CHECK(realm.objects<AllTypesObject>().where("uuid_col IN $0", {std::vector<realm::uuid>{uuids[0]}}).size() == 1);
+
+            // Outside of queries
+            auto obj = realm.objects<AllTypesObject>()[3];
+            CHECK(obj.int_col.in({10, 30}));
+            CHECK_FALSE(obj.str_col.in({"str_1"}));
+            CHECK(obj.uuid_col.in(uuids));
+        }
+
+        SECTION("collection predicates") {
+            auto realm = db(std::move(config));
+            realm.write([&]() {
+                for (int64_t i = 0; i < 5; i++) {
+                    AllTypesObject obj;
+                    obj._id = i;
+                    for (int64_t j = 0; j < i; j++) {
+                        obj.list_int_col.push_back(j * 10);
+                        obj.set_int_col.insert(j);
+                    }
+                    obj.list_str_col = i % 2 ? std::vector<std::string>{"a", "b"} : std::vector<std::string>{"c"};
+                    obj.list_double_col = {i * 1.5};
+                    obj.map_int_col = {{"one", 1}, {"i", i}};
+                    obj.map_str_col = {{"name", "obj_" + std::to_string(i)}};
+                    realm.add(std::move(obj));
+                }
+            });
+
+            auto count = [&realm](std::function<rbool(managed<AllTypesObject>&)>&& fn) {
+                return realm.objects<AllTypesObject>().where(std::move(fn)).size();
+            };
+
+            // Elements of lists and sets
+            CHECK(count([](auto& o) { return o.list_str_col.any() == "a"; }) == 2);
+            CHECK(count([](auto& o) { return o.list_str_col.none() == "a"; }) == 3);
+            CHECK(count([](auto& o) { return o.list_int_col.any() >= 30; }) == 1);
+            CHECK(count([](auto& o) { return o.list_int_col.all() < 20; }) == 3);
+            CHECK(count([](auto& o) { return o.set_int_col.any() == 2; }) == 2);
+
+            // Sizes and aggregates
+            CHECK(count([](auto& o) { return o.list_int_col.count() > 2; }) == 2);
+            CHECK(count([](auto& o) { return o.list_int_col.count() == 0; }) == 1);
+            CHECK(count([](auto& o) { return o.set_int_col.count() >= 1 && o.list_str_col.count() == 1; }) == 2);
+            CHECK(count([](auto& o) { return o.list_int_col.sum() > 20; }) == 2);
+            CHECK(count([](auto& o) { return o.list_int_col.sum() == 0; }) == 2);
+            CHECK(count([](auto& o) { return o.list_int_col.max() == 20; }) == 1);
+            CHECK(count([](auto& o) { return o.list_int_col.min() == 0; }) == 4);
+            CHECK(count([](auto& o) { return o.list_int_col.avg() > 5.0; }) == 2);
+            CHECK(count([](auto& o) { return o.list_double_col.sum() >= 3.0; }) == 3);
+
+            // Dictionaries
+            CHECK(count([](auto& o) { return o.map_int_col.any() == 3; }) == 1);
+            CHECK(count([](auto& o) { return o.map_int_col.all() >= 1; }) == 4);
+            CHECK(count([](auto& o) { return o.map_int_col.for_key("i") > 2; }) == 2);
+            CHECK(count([](auto& o) { return o.map_int_col.for_key("missing") == 0; }) == 0);
+            CHECK(count([](auto& o) { return o.map_int_col.keys() == "one"; }) == 5);
+            CHECK(count([](auto& o) { return o.map_int_col.sum() == 5; }) == 1);
+            CHECK(count([](auto& o) { return o.map_str_col.for_key("name") == "obj_1" || o.map_str_col.for_key("name") == "obj_4"; }) == 2);
+
+            // Outside of queries
+            auto obj = realm.objects<AllTypesObject>()[3];
+            CHECK(obj.list_int_col.any() == 20);
+            CHECK_FALSE(obj.list_int_col.all() > 0);
+            CHECK(obj.list_int_col.count() == 3);
+            CHECK(obj.list_int_col.sum() == 30);
+            CHECK(obj.list_int_col.avg() == 10.0);
+            CHECK(obj.set_int_col.max() == 2);
+            CHECK(obj.map_int_col.keys() == "i");
+            CHECK(obj.map_int_col.for_key("i") == 3);
+            CHECK_FALSE(obj.map_int_col.for_key("missing") == 0);
+        }
+
+        SECTION("explain and profiling") {
+            auto realm = db(std::move(config));
+            realm.write([&]() {
+                for (int64_t i = 0; i < 10; i++) {
+                    AllTypesObject obj;
+                    obj._id = i;
+                    obj.int_col = i % 5;
+                    realm.add(std::move(obj));
+                }
+            });
+
+            auto explanation = realm.objects<AllTypesObject>().where([](auto& o) { return o._id == 3; }).explain();
+            CHECK(explanation.index == "_id");
+            CHECK(explanation.table_size == 10);
+            CHECK(explanation.matches == 1);
+            CHECK(explanation.selectivity == 0.1);
+            CHECK_FALSE(explanation.description.empty());
+
+            explanation = realm.objects<AllTypesObject>().where([](auto& o) { return o.int_col == 3; }).explain();
+            CHECK_FALSE(explanation.index);
+            CHECK(explanation.matches == 2);
+            explanation = realm.objects<AllTypesObject>().where([](auto& o) { return o.int_col > 0 && o._id.in({1, 2, 5}); }).explain();
+            CHECK(explanation.index == "_id");
+            CHECK(explanation.matches == 2);
+            explanation = realm.objects<AllTypesObject>().where([](auto& o) { return o._id == 1 || o.int_col == 1; }).explain();
+            CHECK_FALSE(explanation.index);
+            explanation = realm.objects<AllTypesObject>().where("int_col >= $0", {2}).explain();
+            CHECK_FALSE(explanation.index);
+            CHECK(explanation.matches == 6);
+            CHECK(realm.objects<AllTypesObject>().explain().matches == 10);
+
+            std::vector<query_timing> timings;
+            // Removes the profiler, which refers to `timings`, even if an assertion fails.
+            struct reset_profiler {
+                ~reset_profiler() {
+                    set_query_profiler(nullptr);
+                }
+            } reset;
+            set_query_profiler([&timings](const query_timing& timing) { timings.push_back(timing); });
+            CHECK(realm.objects<AllTypesObject>().where([](auto& o) { return o.int_col < 2; }).size() == 4);
+            CHECK(realm.objects<AllTypesObject>().where("_id > $0", {7}).size() == 2);
+            REQUIRE(timings.size() == 2);
+            CHECK(timings[0].matches == 4);
+            CHECK(timings[1].matches == 2);
+            CHECK_FALSE(timings[1].description.empty());
+            CHECK(timings[0].total() == timings[0].build + timings[0].evaluation + timings[0].materialization);
+            // Prepared queries are profiled on every execution.
+            auto by_int_col = realm.objects<AllTypesObject>().prepare<int64_t>([](auto& o, int64_t v) { return o.int_col == v; });
+            CHECK(by_int_col.execute(3).size() == 2);
+            CHECK(by_int_col.execute(3).size() == 2);
+            REQUIRE(timings.size() == 4);
+            CHECK(timings[2].matches == 2);
+            CHECK(timings[3].matches == 2);
+            // Profiled results are still updated by later writes.
+            auto results = realm.objects<AllTypesObject>().where([](auto& o) { return o.int_col < 2; });
+            CHECK(results.explain().index == std::nullopt);
+            realm.write([&]() {
+                AllTypesObject obj;
+                obj._id = 10;
+                obj.int_col = 0;
+                realm.add(std::move(obj));
+            });
+            CHECK(results.size() == 5);
+            set_query_profiler(nullptr);
+            realm.objects<AllTypesObject>().where([](auto& o) { return o.int_col < 2; });
+            by_int_col.execute(4);
+            CHECK(timings.size() == 5);
+
+            struct test_logger : public logger {
+                std::vector<std::string> messages;
+                void do_log(logger::level, const std::string& message) override {
+                    messages.push_back(message);
+                }
+            };
+            // Restores the logger and threshold of other tests, even if an assertion fails.
+            struct restore_logging {
+                std::shared_ptr<util::Logger> previous = util::Logger::get_default_logger();
+                ~restore_logging() {
+                    set_slow_query_threshold(std::nullopt);
+                    util::Logger::set_default_logger(previous);
+                }
+            } restore;
+            auto log = std::make_shared<test_logger>();
+            auto log_ref = log;
+            set_default_logger(std::move(log_ref));
+            set_slow_query_threshold(std::chrono::microseconds(0));
+            realm.objects<AllTypesObject>().where([](auto& o) { return o.int_col == 4; });
+            set_slow_query_threshold(std::chrono::hours(1));
+            realm.objects<AllTypesObject>().where([](auto& o) { return o.int_col == 4; });
+            set_slow_query_threshold(std::nullopt);
+            auto slow_queries = std::count_if(log->messages.begin(), log->messages.end(), [](const std::string& message) {
+                return message.find("Slow query") != std::string::npos;
+            });
+            CHECK(slow_queries == 1);
+        }
+
+        SECTION("keyset pagination") {
+            auto realm = db(std::move(config));
+            realm.write([&]() {
+                for (int64_t i = 0; i < 25; i++) {
+                    AllTypesObject obj;
+                    obj._id = i;
+                    obj.int_col = i % 5;
+                    obj.double_col = static_cast<double>(i) / 2;
+                    realm.add(std::move(obj));
+                }
+            });
+
+            auto read_all = [&realm](auto&& sorted, size_t page_size) {
+                std::vector<int64_t> ids;
+                page_cursor cursor;
+                while (true) {
+                    auto page = sorted.after(cursor).take(page_size);
+                    CHECK(page.size() <= page_size);
+                    for (auto& obj : page) {
+                        ids.push_back(obj._id.detach().value);
+                    }
+                    auto next = page.next_cursor();
+                    if (!next) {
+                        break;
+                    }
+                    // Cursors are passed on as tokens.
+                    cursor = page_cursor::from_string(next->to_string());
+                    CHECK(cursor == *next);
+                }
+                return ids;
+            };
+
+            // Ties on the sort key are ordered by the primary key.
+            std::vector<int64_t> expected;
+            for (int64_t key = 0; key < 5; key++) {
+                for (int64_t id = key; id < 25; id += 5) {
+                    expected.push_back(id);
+                }
+            }
+            CHECK(read_all(realm.objects<AllTypesObject>().sorted_by(&AllTypesObject::int_col), 4) == expected);
+            CHECK(read_all(realm.objects<AllTypesObject>().sorted_by(&AllTypesObject::int_col), 5) == expected);
+
+            std::vector<int64_t> descending;
+            for (int64_t id = 24; id >= 0; id--) {
+                descending.push_back(id);
+            }
+            CHECK(read_all(realm.objects<AllTypesObject>().sorted_by(&AllTypesObject::double_col, false), 7) == descending);
+            CHECK(read_all(realm.objects<AllTypesObject>().sorted_by(&AllTypesObject::_id, false), 10) == descending);
+
+            auto filtered = realm.objects<AllTypesObject>().where([](auto& o) { return o.int_col == 2; }).sorted_by(&AllTypesObject::_id);
+            CHECK(read_all(filtered, 2) == std::vector<int64_t>{2, 7, 12, 17, 22});
+
+            // A page after a cursor does not change when objects before it are added.
+            auto sorted = realm.objects<AllTypesObject>().sorted_by(&AllTypesObject::_id);
+            auto first = sorted.take(10);
+            auto cursor = *first.next_cursor();
+            realm.write([&]() {
+                AllTypesObject obj;
+                obj._id = -1;
+                realm.add(std::move(obj));
+            });
+            auto second = sorted.after(cursor).take(10);
+            CHECK(second[0]._id.detach().value == 10);
+            CHECK(first.size() == 10);
+            CHECK(first[0]._id.detach().value == -1);
+
+            CHECK(page_cursor().is_start());
+            CHECK(page_cursor::from_string("").is_start());
+            CHECK_THROWS_AS(page_cursor::from_string("not a cursor"), std::invalid_argument);
+            CHECK_THROWS_AS(page_cursor::from_string(cursor.to_string().substr(2)), std::invalid_argument);
+            CHECK_THROWS_AS(realm.objects<AllTypesObject>().sorted_by(&AllTypesObject::int_col).after(cursor).take(10),
+                            std::invalid_argument);
+        }
+
+        SECTION("geospatial") {
+            auto realm = db(std::move(config));
+            std::vector<std::pair<std::string, std::optional<geo_point>>> places = {
+                {"Times Square", geo_point(-73.9855, 40.7580)},
+                {"Empire State Building", geo_point(-73.9857, 40.7484)},
+                {"Brooklyn Bridge", geo_point(-73.9969, 40.7061)},
+                {"Trafalgar Square", geo_point(-0.1281, 51.5080)},
+                {"Unknown", std::nullopt}
+            };
+            realm.write([&]() {
+                for (size_t i = 0; i < places.size(); i++) {
+                    Venue venue;
+                    venue._id = static_cast<int64_t>(i);
+                    venue.name = places[i].first;
+                    if (places[i].second) {
+                        venue.location = &*places[i].second;
+                    }
+                    realm.add(std::move(venue));
+                }
+            });
+            auto count = [&realm](std::function<rbool(managed<Venue>&)>&& fn) {
+                return realm.objects<Venue>().where(std::move(fn)).size();
+            };
+
+            // The Empire State Building is about a kilometer from Times Square.
+            auto times_square = geo_circle::from_kilometers({-73.9855, 40.7580}, 2);
+            CHECK(count([&](auto& v) { return v.location.geo_within(times_square); }) == 2);
+            CHECK(count([&](auto& v) { return v.location.geo_within(geo_circle::from_kilometers({-73.9855, 40.7580}, 10)); }) == 3);
+            CHECK(count([&](auto& v) { return v.location.geo_within(geo_circle::from_kilometers({-73.9855, 40.7580}, 6000)); }) == 4);
+
+            geo_box lower_manhattan{{-74.0, 40.70}, {-73.98, 40.76}};
+            CHECK(count([&](auto& v) { return v.location.geo_within(lower_manhattan); }) == 3);
+            CHECK(count([&](auto& v) { return v.location.geo_within(lower_manhattan) && v.name != "Brooklyn Bridge"; }) == 2);
+
+            geo_polygon midtown{{{-74.0, 40.74}, {-73.97, 40.74}, {-73.97, 40.77}, {-74.0, 40.77}, {-74.0, 40.74}}, {}};
+            CHECK(count([&](auto& v) { return v.location.geo_within(midtown); }) == 2);
+            midtown.holes.push_back({{-73.99, 40.755}, {-73.98, 40.755}, {-73.98, 40.76}, {-73.99, 40.76}, {-73.99, 40.755}});
+            CHECK(count([&](auto& v) { return v.location.geo_within(midtown); }) == 1);
+
+            CHECK(realm.objects<Venue>().where("location GEOWITHIN geoCircle([-73.9855, 40.7580], 0.0003136)", {}).size() == 2);
+            CHECK(realm.objects<Venue>().where("location GEOWITHIN $0", {times_square}).size() == 2);
+            std::string prefix = "B";
+            CHECK(realm.objects<Venue>().where("location GEOWITHIN $0 AND name BEGINSWITH $1",
+                                               {lower_manhattan, internal::bridge::mixed(prefix)}).size() == 1);
+
+            // Outside of queries the location of the object is compared.
+            auto venues = realm.objects<Venue>();
+            CHECK(venues[0].location.geo_within(times_square));
+            CHECK_FALSE(venues[2].location.geo_within(times_square));
+            CHECK_FALSE(venues[4].location.geo_within(times_square));
+        }
     }
 }
\ No newline at end of file
@@ -1,6 +1,12 @@
 #include "../../main.hpp"
 #include "test_objects.hpp"
 
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+
 namespace realm::experimental {
 
     TEST_CASE("results", "[results]") {
@@ -160,6 +166,274 @@ namespace realm::experimental {
             CHECK(did_run);
         }
 
+        SECTION("results_notifications_coalesced") {
+            auto realm = db(std::move(config));
+            auto results = realm.objects<AllTypesObject>();
+
+            std::vector<coalesced_change> changes;
+            auto token = results.observe_coalesced([&](coalesced_change&& c) {
+                changes.push_back(std::move(c));
+            }, coalescing_options{std::chrono::hours(1)});
+
+            realm.write([&realm] {
+                for (int64_t i = 0; i < 3; i++) {
+                    AllTypesObject o;
+                    o._id = i;
+                    realm.add(std::move(o));
+                }
+            });
+            realm.write([] {});
+
+            // The initial notification and the first change are not held back.
+            REQUIRE(changes.size() == 2);
+            CHECK(changes[0].empty());
+            CHECK(changes[1].insertions == std::vector<index_range>{{0, 3}});
+            CHECK(changes[1].commit_count == 1);
+
+            for (int64_t i = 3; i < 6; i++) {
+                realm.write([&realm, i] {
+                    AllTypesObject o;
+                    o._id = i;
+                    realm.add(std::move(o));
+                });
+            }
+            realm.write([] {});
+
+            // Everything after the first change falls inside the interval.
+            CHECK(changes.size() == 2);
+            auto stats = token.stats();
+            CHECK(stats.delivered == 1);
+            CHECK(stats.merged == 2);
+            CHECK(stats.suppressed >= 2);
+
+            token.unregister();
+        }
+
+        SECTION("results_notifications_coalesced_flush") {
+            // Held back notifications are flushed by a timer, which invokes the Realm's
+            // scheduler, so the Realm is confined to a worker which runs without a run loop.
+            auto pool = std::make_shared<thread_pool_scheduler>(1);
+            auto scheduler = pool->pin(0);
+            config.set_scheduler(scheduler);
+
+            std::optional<db> realm;
+            std::optional<results<AllTypesObject>> results;
+            std::optional<coalesced_notification_token> token;
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::vector<coalesced_change> changes;
+            std::vector<std::chrono::steady_clock::time_point> delivery_times;
+
+            auto on_worker = [&](auto&& fn) {
+                std::promise<void> done;
+                scheduler->invoke([&] {
+                    fn();
+                    done.set_value();
+                });
+                done.get_future().wait();
+            };
+            auto wait_for_changes = [&](size_t count) {
+                std::unique_lock lock(mutex);
+                return cv.wait_for(lock, std::chrono::seconds(10), [&] { return changes.size() >= count; });
+            };
+            auto add_object = [&](int64_t id) {
+                on_worker([&] {
+                    realm->write([&] {
+                        AllTypesObject o;
+                        o._id = id;
+                        realm->add(std::move(o));
+                    });
+                });
+            };
+
+            const auto window = std::chrono::milliseconds(200);
+            const auto min_interval = std::chrono::milliseconds(400);
+            on_worker([&] {
+                realm.emplace(std::move(config));
+                results.emplace(realm->objects<AllTypesObject>());
+                token.emplace(results->observe_coalesced([&](coalesced_change&& c) {
+                    std::lock_guard lock(mutex);
+                    changes.push_back(std::move(c));
+                    delivery_times.push_back(std::chrono::steady_clock::now());
+                    cv.notify_all();
+                }, coalescing_options{min_interval, window}));
+            });
+            REQUIRE(wait_for_changes(1));
+
+            // Commits within the window of the first one are merged into one change set,
+            // delivered once the window has passed.
+            auto first_write = std::chrono::steady_clock::now();
+            for (int64_t i = 0; i < 3; i++) {
+                add_object(i);
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            REQUIRE(wait_for_changes(2));
+            {
+                std::lock_guard lock(mutex);
+                CHECK(delivery_times[1] - first_write >= window);
+                CHECK(changes[1].insertions == std::vector<index_range>{{0, 3}});
+                CHECK(changes[1].deletions.empty());
+                CHECK(changes[1].commit_count > 1);
+                CHECK(changes[1].commit_count == 1 + token->stats().merged);
+            }
+
+            // The next change is held back until the minimum interval since the last
+            // delivery has passed.
+            add_object(3);
+            REQUIRE(wait_for_changes(3));
+            {
+                std::lock_guard lock(mutex);
+                CHECK(delivery_times[2] - delivery_times[1] >= min_interval);
+                CHECK(changes[2].insertions == std::vector<index_range>{{3, 4}});
+                CHECK(changes[2].commit_count == 1);
+                CHECK(token->stats().delivered == 2);
+            }
+
+            on_worker([&] {
+                token.reset();
+                results.reset();
+                realm.reset();
+            });
+        }
+
+        SECTION("results_notifications_coalesced_modifications") {
+            auto pool = std::make_shared<thread_pool_scheduler>(1);
+            auto scheduler = pool->pin(0);
+            config.set_scheduler(scheduler);
+
+            std::optional<db> realm;
+            std::optional<results<AllTypesObject>> results;
+            std::optional<coalesced_notification_token> token;
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::vector<coalesced_change> changes;
+
+            auto on_worker = [&](auto&& fn) {
+                std::promise<void> done;
+                scheduler->invoke([&] {
+                    fn();
+                    done.set_value();
+                });
+                done.get_future().wait();
+            };
+            auto wait_for_changes = [&](size_t count) {
+                std::unique_lock lock(mutex);
+                return cv.wait_for(lock, std::chrono::seconds(10), [&] { return changes.size() >= count; });
+            };
+            // Removes the object at `removed` and then modifies the one at `modified`, both
+            // given as indices before the commit.
+            auto remove_and_modify = [&](size_t removed, size_t modified) {
+                on_worker([&] {
+                    auto to_remove = (*results)[removed];
+                    auto to_modify = (*results)[modified];
+                    realm->write([&] {
+                        realm->remove(to_remove);
+                        to_modify.str_col = "modified";
+                    });
+                });
+            };
+
+            on_worker([&] {
+                realm.emplace(std::move(config));
+                realm->write([&] {
+                    for (int64_t i = 0; i < 4; i++) {
+                        AllTypesObject o;
+                        o._id = i;
+                        realm->add(std::move(o));
+                    }
+                });
+                results.emplace(realm->objects<AllTypesObject>());
+                token.emplace(results->observe_coalesced([&](coalesced_change&& c) {
+                    std::lock_guard lock(mutex);
+                    changes.push_back(std::move(c));
+                    cv.notify_all();
+                }, coalescing_options{std::chrono::milliseconds(0), std::chrono::milliseconds(200)}));
+            });
+            REQUIRE(wait_for_changes(1));
+
+            // Objects 0, 1, 2, 3: the first commit removes 0 and modifies 2, which moves to
+            // index 1. The second removes 1 and modifies 3, which ends up at index 1, while
+            // 2 moves on to index 0.
+            remove_and_modify(0, 2);
+            remove_and_modify(0, 2);
+            REQUIRE(wait_for_changes(2));
+            {
+                std::lock_guard lock(mutex);
+                CHECK(changes[1].commit_count == 2);
+                CHECK(changes[1].deletions == std::vector<index_range>{{0, 2}});
+                CHECK(changes[1].insertions.empty());
+                CHECK(changes[1].modifications == std::vector<index_range>{{0, 2}});
+            }
+
+            on_worker([&] {
+                token.reset();
+                results.reset();
+                realm.reset();
+            });
+        }
+
+        SECTION("results_notifications_ranges") {
+            auto realm = db(std::move(config));
+            auto results = realm.objects<AllTypesObject>();
+
+            int run_count = 0;
+            std::vector<index_range> insertions;
+            size_t insertion_count = 0;
+            auto token = results.observe_ranges([&](collection_range_change c) {
+                run_count++;
+                insertions.assign(c.insertions.begin(), c.insertions.end());
+                insertion_count = c.insertions.count();
+                CHECK(c.deletions.empty());
+            });
+            realm.refresh();
+            CHECK(run_count == 1);
+            CHECK(insertions.empty());
+
+            realm.write([&realm] {
+                for (int64_t i = 0; i < 100; i++) {
+                    AllTypesObject o;
+                    o._id = i;
+                    realm.add(std::move(o));
+                }
+            });
+            realm.refresh();
+            CHECK(run_count == 2);
+            CHECK(insertions == std::vector<index_range>{{0, 100}});
+            CHECK(insertion_count == 100);
+        }
+
+        SECTION("results_notifications_keypath") {
+            auto obj = AllTypesObject();
+
+            auto realm = db(std::move(config));
+            auto managed_obj = realm.write([&realm, &obj] {
+                return realm.add(std::move(obj));
+            });
+
+            int run_count = 0;
+            results<AllTypesObject>::results_change change;
+            auto results = realm.objects<AllTypesObject>();
+            auto token = results.observe([&](auto&& c) {
+                run_count++;
+                change = std::move(c);
+            }, {&AllTypesObject::str_col});
+            realm.refresh();
+            CHECK(run_count == 1);
+
+            realm.write([&managed_obj] {
+                managed_obj.int_col = 42;
+            });
+            realm.refresh();
+            CHECK(run_count == 1);
+
+            realm.write([&managed_obj] {
+                managed_obj.str_col = "foobar";
+            });
+            realm.refresh();
+            CHECK(run_count == 2);
+            CHECK(change.modifications.size() == 1);
+        }
+
         managed<AllTypesObject> test_obj;
 
         SECTION("results_subscript") {
@@ -226,5 +500,83 @@ namespace realm::experimental {
             CHECK(count == 2);
 
         }
+
+        SECTION("results_remove_all") {
+            auto realm = db(std::move(config));
+            realm.write([&realm] {
+                for (int64_t i = 0; i < 5; i++) {
+                    Person p;
+                    p._id = i;
+                    p.age = i * 10;
+                    p.dog = nullptr;
+                    realm.add(std::move(p));
+                }
+            });
+            auto people = realm.objects<Person>();
+            realm::experimental::results<Person>::results_change change;
+            auto token = people.observe([&](auto&& c) {
+                change = std::move(c);
+            });
+            realm.refresh();
+
+            auto young = realm.objects<Person>().where([](auto& p) { return p.age < 30; });
+            CHECK_THROWS(young.remove_all());
+            realm.write([&young] {
+                young.remove_all();
+            });
+            realm.refresh();
+
+            CHECK(young.size() == 0);
+            CHECK(people.size() == 2);
+            CHECK(people[0].age == 30);
+            CHECK(people[1].age == 40);
+            CHECK(change.deletions == std::vector<uint64_t>{0, 1, 2});
+            CHECK(change.insertions.empty());
+            CHECK(change.modifications.empty());
+        }
+
+        SECTION("results_set_all") {
+            auto realm = db(std::move(config));
+            realm.write([&realm] {
+                for (int64_t i = 0; i < 5; i++) {
+                    Person p;
+                    p._id = i;
+                    p.name = "John";
+                    p.age = i * 10;
+                    p.dog = nullptr;
+                    realm.add(std::move(p));
+                }
+            });
+            auto people = realm.objects<Person>();
+            realm::experimental::results<Person>::results_change change;
+            auto token = people.observe([&](auto&& c) {
+                change = std::move(c);
+            });
+            realm.refresh();
+
+            auto young = realm.objects<Person>().where([](auto& p) { return p.age < 30; });
+            CHECK_THROWS(young.set_all(&Person::age, 30));
+            // The objects which stop matching because of the update are still updated, and
+            // later calls see that they no longer match.
+            realm.write([&young] {
+                young.set_all(&Person::name, "Jane");
+                young.set_all(&Person::age, 30);
+                young.set_all(&Person::name, "Joe");
+            });
+            realm.refresh();
+
+            CHECK(young.size() == 0);
+            CHECK(people.size() == 5);
+            for (size_t i = 0; i < 3; i++) {
+                CHECK(people[i].age == 30);
+                CHECK(people[i].name == "Jane");
+            }
+            CHECK(people[3].age == 30);
+            CHECK(people[3].name == "John");
+            CHECK(people[4].age == 40);
+            CHECK(change.modifications == std::vector<uint64_t>{0, 1, 2});
+            CHECK(change.insertions.empty());
+            CHECK(change.deletions.empty());
+        }
     }
-}
\ No newline at end of file
+}
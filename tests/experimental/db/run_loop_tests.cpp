@@ -1,5 +1,6 @@
 #include "../../main.hpp"
 #include "test_objects.hpp"
+#include <algorithm>
 #include <functional>
 #include <mutex>
 
@@ -494,3 +495,205 @@ TEST_CASE("run loops", "[run loops]") {
     }
 }
 #endif
+
+#ifdef CPPREALM_HAVE_COROUTINES
+static realm::task<size_t> write_and_observe(realm::experimental::db& realm,
+                                             realm::experimental::results<realm::experimental::AllTypesObject>& results) {
+    auto changes = results.changes();
+    auto obj = co_await realm.async_write([&realm] {
+        realm::experimental::AllTypesObject o;
+        o._id = 1;
+        return realm.add(std::move(o));
+    });
+    auto inserted = co_await changes.next();
+    CHECK(inserted.insertions.size() == 1);
+
+    co_await realm.async_write([&obj] {
+        obj.str_col = "456";
+    });
+    auto modified = co_await changes.next();
+    CHECK(modified.modifications.size() == 1);
+    co_return results.size();
+}
+
+static realm::task<void> write_in_order(realm::experimental::db& realm, int64_t id, std::vector<int64_t>& order) {
+    co_await realm.async_write([&realm, id] {
+        realm::experimental::AllTypesObject o;
+        o._id = id;
+        realm.add(std::move(o));
+    });
+    order.push_back(id);
+}
+#endif
+
+TEST_CASE("thread pool scheduler", "[run loops]") {
+    realm_path path;
+
+    SECTION("affinity") {
+        auto pool = std::make_shared<realm::thread_pool_scheduler>(4);
+        CHECK(pool->worker_count() == 4);
+        CHECK_FALSE(pool->is_on_thread());
+        CHECK(pool->pin(0)->is_same_as(pool.get()));
+        CHECK_FALSE(pool->pin(1)->is_same_as(pool.get()));
+        CHECK(pool->pin(5)->worker_index() == 1);
+
+        for (size_t i = 0; i < pool->worker_count(); i++) {
+            auto pinned = pool->pin(i);
+            std::promise<std::thread::id> first;
+            std::promise<std::thread::id> second;
+            pinned->invoke([&] {
+                CHECK(pinned->is_on_thread());
+                CHECK_FALSE(pool->pin(i + 1)->is_on_thread());
+                first.set_value(std::this_thread::get_id());
+            });
+            pinned->invoke([&] {
+                second.set_value(std::this_thread::get_id());
+            });
+            CHECK(first.get_future().get() == second.get_future().get());
+        }
+    }
+
+    SECTION("submit") {
+        auto pool = std::make_shared<realm::thread_pool_scheduler>(4);
+        std::atomic<int> count = 0;
+        std::promise<void> done;
+        for (int i = 0; i < 1000; i++) {
+            pool->submit([&] {
+                if (count.fetch_add(1) == 999) {
+                    done.set_value();
+                }
+            });
+        }
+        done.get_future().wait();
+        CHECK(count == 1000);
+    }
+
+    SECTION("observe on pinned worker") {
+        auto pool = std::make_shared<realm::thread_pool_scheduler>(2);
+        auto scheduler = pool->pin(1);
+
+        std::optional<realm::experimental::db> realm;
+        std::optional<realm::experimental::managed<realm::experimental::AllTypesObject>> managed_obj;
+        realm::notification_token token;
+        std::promise<std::string> changed;
+
+        std::promise<void> opened;
+        scheduler->invoke([&] {
+            realm.emplace(realm::db_config(path, scheduler));
+            managed_obj.emplace(realm->write([&] {
+                return realm->add(realm::experimental::AllTypesObject());
+            }));
+            token = managed_obj->observe([&](auto&& change) {
+                CHECK(scheduler->is_on_thread());
+                changed.set_value(change.property_changes[0].name);
+            });
+            realm->write([&] {
+                managed_obj->str_col = "456";
+            });
+            opened.set_value();
+        });
+        opened.get_future().wait();
+        CHECK(changed.get_future().get() == "str_col");
+
+        std::promise<void> closed;
+        scheduler->invoke([&] {
+            token.unregister();
+            managed_obj.reset();
+            realm.reset();
+            closed.set_value();
+        });
+        closed.get_future().wait();
+    }
+
+    SECTION("write from another thread") {
+        auto pool = std::make_shared<realm::thread_pool_scheduler>(2);
+        auto scheduler = pool->pin(1);
+
+        std::optional<realm::experimental::db> realm;
+        std::optional<realm::experimental::results<realm::experimental::AllTypesObject>> results;
+        realm::notification_token token;
+        std::promise<std::vector<uint64_t>> changed;
+
+        std::promise<void> opened;
+        scheduler->invoke([&] {
+            realm.emplace(realm::db_config(path, scheduler));
+            results.emplace(realm->objects<realm::experimental::AllTypesObject>());
+            token = results->observe([&](auto&& change) {
+                CHECK(scheduler->is_on_thread());
+                // Skip the initial notification.
+                if (!change.insertions.empty()) {
+                    changed.set_value(change.insertions);
+                }
+            });
+            opened.set_value();
+        });
+        opened.get_future().wait();
+
+        // The write is made by another Realm on this thread, so the notification is
+        // delivered by the pool rather than by a run loop.
+        realm::db_config config;
+        config.set_path(path);
+        auto writer = realm::experimental::db(std::move(config));
+        writer.write([&writer] {
+            realm::experimental::AllTypesObject o;
+            o._id = 1;
+            writer.add(std::move(o));
+        });
+
+        auto future = changed.get_future();
+        REQUIRE(future.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+        CHECK(future.get() == std::vector<uint64_t>{0});
+
+        std::promise<void> closed;
+        scheduler->invoke([&] {
+            token.unregister();
+            results.reset();
+            realm.reset();
+            closed.set_value();
+        });
+        closed.get_future().wait();
+    }
+
+#ifdef CPPREALM_HAVE_COROUTINES
+    SECTION("coroutines on pinned worker") {
+        auto pool = std::make_shared<realm::thread_pool_scheduler>(2);
+        auto scheduler = pool->pin(1);
+
+        std::optional<realm::experimental::db> realm;
+        std::optional<realm::experimental::results<realm::experimental::AllTypesObject>> results;
+        std::promise<std::future<size_t>> observed;
+        std::vector<int64_t> order;
+        std::vector<std::future<void>> writes;
+
+        scheduler->invoke([&] {
+            realm.emplace(realm::db_config(path, scheduler));
+            results.emplace(realm->objects<realm::experimental::AllTypesObject>());
+            observed.set_value(realm::spawn(write_and_observe(*realm, *results)));
+        });
+        CHECK(observed.get_future().get().get() == 1);
+
+        std::promise<void> started;
+        scheduler->invoke([&] {
+            for (int64_t i = 2; i < 1002; i++) {
+                writes.push_back(realm::spawn(write_in_order(*realm, i, order)));
+            }
+            started.set_value();
+        });
+        started.get_future().wait();
+        for (auto& w : writes) {
+            w.get();
+        }
+
+        std::promise<void> closed;
+        scheduler->invoke([&] {
+            CHECK(order.size() == 1000);
+            CHECK(std::is_sorted(order.begin(), order.end()));
+            CHECK(results->size() == 1001);
+            results.reset();
+            realm.reset();
+            closed.set_value();
+        });
+        closed.get_future().wait();
+    }
+#endif
+}
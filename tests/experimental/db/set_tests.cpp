@@ -355,6 +355,68 @@ TEST_CASE("set", "[set]") {
         CHECK(managed_obj.set_int_col.detach() == std::set<int64_t>({1}));
     }
 
+    SECTION("set_algebra") {
+        auto realm = realm::experimental::db(std::move(config));
+        auto obj_a = realm::experimental::AllTypesObject();
+        obj_a._id = 1;
+        obj_a.set_int_col = {1, 2, 3};
+        auto obj_b = realm::experimental::AllTypesObject();
+        obj_b._id = 2;
+        obj_b.set_int_col = {2, 3};
+        auto obj_c = realm::experimental::AllTypesObject();
+        obj_c._id = 3;
+        obj_c.set_int_col = {4};
+
+        auto [a, b, c] = realm.write([&]() {
+            return std::make_tuple(realm.add(std::move(obj_a)), realm.add(std::move(obj_b)), realm.add(std::move(obj_c)));
+        });
+
+        CHECK(b.set_int_col.is_subset_of(a.set_int_col));
+        CHECK_FALSE(a.set_int_col.is_subset_of(b.set_int_col));
+        CHECK(a.set_int_col.is_superset_of(b.set_int_col));
+        CHECK(a.set_int_col.intersects(b.set_int_col));
+        CHECK_FALSE(a.set_int_col.intersects(c.set_int_col));
+
+        realm.write([&]() {
+            a.set_int_col.merge(c.set_int_col);
+        });
+        CHECK(a.set_int_col.detach() == std::set<int64_t>({1, 2, 3, 4}));
+
+        realm.write([&]() {
+            a.set_int_col.subtract(b.set_int_col);
+        });
+        CHECK(a.set_int_col.detach() == std::set<int64_t>({1, 4}));
+
+        realm.write([&]() {
+            a.set_int_col.intersect(c.set_int_col);
+        });
+        CHECK(a.set_int_col.detach() == std::set<int64_t>({4}));
+        CHECK(a.set_int_col.set_equals(c.set_int_col));
+    }
+
+    SECTION("iterator blocks") {
+        auto realm = realm::experimental::db(std::move(config));
+        auto managed_obj = realm.write([&]() {
+            return realm.add(realm::experimental::AllTypesObject());
+        });
+        std::set<int64_t> values;
+        for (int64_t i = 0; i < 2500; i++) {
+            values.insert(i);
+        }
+        realm.write([&]() {
+            for (auto v : values) {
+                managed_obj.set_int_col.insert(v);
+            }
+        });
+
+        std::set<int64_t> res;
+        for (auto x : managed_obj.set_int_col) {
+            res.insert(x);
+        }
+        CHECK(res == values);
+        CHECK(managed_obj.set_int_col.detach() == values);
+    }
+
     SECTION("iterator") {
         auto realm = realm::experimental::db(std::move(config));
         auto obj = realm::experimental::AllTypesObject();
@@ -29,6 +29,50 @@ namespace realm::experimental {
             });
             CHECK(managed_obj.str_col.contains("oo"));
         }
+
+        SECTION("managed_str_edit", "[str]") {
+            auto obj = AllTypesObject();
+            auto realm = db(std::move(config));
+            auto managed_obj = realm.write([&realm, &obj] {
+                obj.str_col = "foo";
+                return realm.add(std::move(obj));
+            });
+
+            realm.write([&managed_obj] {
+                auto edit = managed_obj.str_col.edit();
+                (*edit)[0] = 'b';
+                for (size_t i = 0; i < 1000; i++) {
+                    edit->push_back('o');
+                }
+                edit->pop_back();
+                // Nothing is written back until the edit is committed.
+                CHECK(managed_obj.str_col == "foo");
+                edit.commit();
+            });
+            CHECK(managed_obj.str_col.size() == 1002);
+            CHECK(managed_obj.str_col.detach() == "boo" + std::string(999, 'o'));
+
+            realm.write([&managed_obj] {
+                auto edit = managed_obj.str_col.edit();
+                *edit = "bar";
+                edit.commit();
+                CHECK(managed_obj.str_col == "bar");
+                *edit = "baz";
+                edit.discard();
+            });
+            CHECK(managed_obj.str_col == "bar");
+
+            // Uncommitted changes are discarded when the edit goes out of scope, even
+            // outside of a write transaction.
+            CHECK_NOTHROW([&managed_obj] {
+                auto edit = managed_obj.str_col.edit();
+                *edit = "qux";
+            }());
+            CHECK(managed_obj.str_col == "bar");
+
+            // An edit which changes nothing does not write, so needs no write transaction.
+            CHECK_NOTHROW([&managed_obj] { managed_obj.str_col.edit().commit(); }());
+        }
     }
 }
 
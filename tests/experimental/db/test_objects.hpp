@@ -2,6 +2,7 @@
 #define CPPREALM_EXPERIMENTAL_TEST_OBJECTS_HPP
 
 #include <cpprealm/experimental/sdk.hpp>
+#include <cpprealm/experimental/geospatial.hpp>
 
 namespace realm::experimental {
     struct Dog;
@@ -12,6 +13,13 @@ namespace realm::experimental {
         Dog* dog;
     };
     REALM_SCHEMA(Person, _id, name, age, dog)
+
+    struct Venue {
+        primary_key<int64_t> _id;
+        std::string name;
+        geo_point* location = nullptr;
+    };
+    REALM_SCHEMA(Venue, _id, name, location)
     struct Dog {
         primary_key<int64_t> _id;
         std::string name;